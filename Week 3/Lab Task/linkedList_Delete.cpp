@@ -8,6 +8,7 @@ struct Node {
 };
 
 Node* list = NULL;
+Node* tail = NULL;  // Last node, so insert() does not walk the whole list
 
 void insert(int value) {
     Node* temp = new Node();  //only writing Node* temp; -> works in C not C++
@@ -18,12 +19,9 @@ void insert(int value) {
     if (list == NULL) {
         list = temp;
     } else {
-        Node* cur = list;
-        while (cur->next != NULL) {
-            cur = cur->next;
-        }
-        cur->next = temp;
+        tail->next = temp;  // O(1): no walk to the end
     }
+    tail = temp;
 }
 
 void display() {
@@ -39,12 +37,15 @@ void deleteElement(int value){
     if (list==NULL)
     {
         cout << "List is empty/NULL";
+        return;
     }
     Node* curr = list;
     if (value==list->data)
     {
         list = list->next;
-        free(curr);
+        if (list == NULL)
+            tail = NULL;
+        delete curr;
         return;
     }
     curr = list->next;
@@ -54,7 +55,9 @@ void deleteElement(int value){
         if (value==curr->data)
         {
             prev->next = curr->next;
-            free(curr);
+            if (curr == tail)
+                tail = prev;
+            delete curr;
             return;
         }
         curr = curr->next;
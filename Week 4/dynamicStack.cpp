@@ -1,7 +1,11 @@
 #include <iostream>
 #include <stdlib.h>
+#include "../log_policy.h"
 using namespace std;
 
+// pop() prints only under VerboseLog (the menu uses pop<VerboseLog>());
+// -DTEACHING_MODE makes that the default (see log_policy.h).
+
 struct Node {
     int data;
     Node* next;
@@ -16,20 +20,28 @@ void push(int value) {
     top = temp;
 }
 
-void pop() {
+// Removes the top element; stores it in *value if value is not NULL
+template <typename Log = DefaultLog>
+bool pop(int* value = NULL) {
     if (top == NULL) {
-        cout << "Stack underflow";
-        return;
+        if (Log::enabled)
+            cout << "Stack underflow";
+        return false;
     }
     Node* temp = top;
-    cout << top->data;
-    cout << " has been popped";
+    if (Log::enabled) {
+        cout << top->data;
+        cout << " has been popped";
+    }
+    if (value != NULL)
+        *value = top->data;
     top = top->next;
     free(temp);
+    return true;
 }
 
 int main() {
-    int choice, value;
+    int choice = 0, value;
 
     while (choice != 3){
         cout << "\n1. Push";
@@ -44,7 +56,7 @@ int main() {
             push(value);   
         }
         if (choice==2){
-            pop();
+            pop<VerboseLog>();
         }
         if (choice==3){
             break;
@@ -53,4 +65,4 @@ int main() {
     }
 
     return 0;
-}
\ No newline at end of file
+}
@@ -1,7 +1,84 @@
 #include <iostream>
+#include <climits>
+#include <stdexcept>
+#include "staticStack.h"
 using namespace std;
 
-int main (){
-    int stack[10];
-    int Top
-}
\ No newline at end of file
+/*
+Postfix evaluation of single-digit operands, e.g. "53+2*" = (5+3)*2.
+Returns -1 for a malformed expression (missing operands, leftovers, too deep).
+
+Anything other than a digit or + - * is not an expression at all, and a
+result that does not fit in an int cannot be represented: both throw. In a
+constexpr context (static_assert, constexpr variable) a throw that is
+reached is a compile error, so a typo in the expression stops the build
+instead of quietly evaluating to something.
+*/
+constexpr int applyPostfixOperator(char op, int a, int b) {
+    long long result = op == '+' ? (long long)a + b
+                     : op == '-' ? (long long)a - b
+                     : op == '*' ? (long long)a * b
+                     : throw std::invalid_argument("unknown postfix operator");
+    return result < INT_MIN || result > INT_MAX
+               ? throw std::overflow_error("postfix result does not fit in an int")
+               : (int)result;
+}
+
+constexpr int evaluatePostfix(const char* expr) {
+    StaticStack<int, 16> s = {};
+    for (int i = 0; expr[i] != '\0'; i++) {
+        char c = expr[i];
+        if (c >= '0' && c <= '9') {
+            if (!push(&s, c - '0'))
+                return -1;
+        } else {
+            int b = 0, a = 0;
+            if (!pop(&s, &b) || !pop(&s, &a))
+                return -1;
+            push_unchecked(&s, applyPostfixOperator(c, a, b));
+        }
+    }
+    return size(&s) == 1 ? top_unchecked(&s) : -1;
+}
+
+// Evaluated by the compiler: no code runs for these at all
+static_assert(evaluatePostfix("53+2*") == 16, "(5+3)*2");
+static_assert(evaluatePostfix("234*+") == 14, "2+3*4");
+static_assert(evaluatePostfix("5+") == -1, "missing operand");
+// evaluatePostfix("53/") or evaluatePostfix("99*9*9*9*9*9*9*9*9*9*") would not compile
+
+int main() {
+    StaticStack<int, 5> stack = {};
+
+    for (int value = 10; value <= 60; value += 10) {
+        if (!push(&stack, value))
+            cout << "Stack overflow: " << value << " not pushed" << endl;
+    }
+    display(&stack);
+
+    int value = 0;
+    pop(&stack, &value);
+    cout << value << " has been popped" << endl;
+    peek(&stack, &value);
+    cout << "Top is now " << value << endl;
+
+    while (!isEmpty(&stack))
+        pop_unchecked(&stack);
+    if (!pop(&stack, &value))
+        cout << "Stack underflow" << endl;
+
+    constexpr int result = evaluatePostfix("93-4*");
+    cout << "93-4* = " << result << " (computed at compile time)" << endl;
+
+    // At run time the same errors are exceptions
+    const char* bad[] = {"53/", "99*9*9*9*9*9*9*9*9*9*"};
+    for (const char* expr : bad) {
+        try {
+            int value = evaluatePostfix(expr);
+            cout << expr << " = " << value << endl;
+        } catch (const exception& e) {
+            cout << expr << ": " << e.what() << endl;
+        }
+    }
+    return 0;
+}
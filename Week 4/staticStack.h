@@ -0,0 +1,189 @@
+#ifndef STATIC_STACK_H
+#define STATIC_STACK_H
+
+#include <iostream>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+/*
+STATIC STACK
+------------
+A stack stored in a fixed-size array, like `int stack[10]; int Top;`,
+but for any type T and capacity N:
+
+    StaticStack<int, 10> s = {};
+
+    items: [ 5 ][ 3 ][ 8 ][   ][   ][   ][   ][   ][   ][   ]
+                       ^top = 3 (number of elements; next free slot)
+
+Everything lives in the variable itself (on the function's stack frame):
+no new/malloc, no pointers to follow. push is `items[top++] = x` and pop
+is `items[--top]`.
+
+Checked operations (push, pop, peek) return false instead of overflowing
+or underflowing. The *_unchecked versions skip that test for hot loops
+where the caller already knows it is safe (e.g. it validated the input,
+or just checked size()); with -O2 they compile to a load/store and an
+increment or decrement.
+
+All operations are constexpr, so a StaticStack can even be used while the
+compiler is running (see evaluatePostfix / static_assert in staticStack.cpp).
+Needs C++14. Week 5's task3_templates.cpp and task3_stream_evaluator.cpp
+include this same header.
+*/
+template <typename T, int N>
+struct StaticStack {
+    T items[N] = {};
+    int top = 0;      // Number of elements
+};
+
+template <typename T, int N>
+constexpr bool isEmpty(const StaticStack<T, N>* s) {
+    return s->top == 0;
+}
+
+template <typename T, int N>
+constexpr bool isFull(const StaticStack<T, N>* s) {
+    return s->top == N;
+}
+
+template <typename T, int N>
+constexpr int size(const StaticStack<T, N>* s) {
+    return s->top;
+}
+
+// Checked: false (and no change) when the stack is full
+template <typename T, int N>
+constexpr bool push(StaticStack<T, N>* s, T value) {
+    if (s->top == N)
+        return false;
+    s->items[s->top++] = value;
+    return true;
+}
+
+// Checked: false when the stack is empty, otherwise the top goes to *value
+template <typename T, int N>
+constexpr bool pop(StaticStack<T, N>* s, T* value) {
+    if (s->top == 0)
+        return false;
+    *value = s->items[--s->top];
+    return true;
+}
+
+template <typename T, int N>
+constexpr bool peek(const StaticStack<T, N>* s, T* value) {
+    if (s->top == 0)
+        return false;
+    *value = s->items[s->top - 1];
+    return true;
+}
+
+// Unchecked: the caller guarantees the stack is not full / not empty
+template <typename T, int N>
+constexpr void push_unchecked(StaticStack<T, N>* s, T value) {
+    s->items[s->top++] = value;
+}
+
+template <typename T, int N>
+constexpr T pop_unchecked(StaticStack<T, N>* s) {
+    return s->items[--s->top];
+}
+
+template <typename T, int N>
+constexpr T top_unchecked(const StaticStack<T, N>* s) {
+    return s->items[s->top - 1];
+}
+
+template <typename T, int N>
+void display(const StaticStack<T, N>* s) {
+    std::cout << "Stack (bottom to top): ";
+    for (int i = 0; i < s->top; i++)
+        std::cout << s->items[i] << " ";
+    std::cout << "  [" << s->top << "/" << N << "]" << std::endl;
+}
+
+/*
+RESERVED STACK - the same idea when N is not known at compile time
+------------------------------------------------------------------
+The array is allocated once by reserveStack() and reused: clearStack()
+only resets top, so a program that runs many short computations (one per
+input line, say) allocates nothing per push or per computation. If a
+computation goes deeper than the reservation, push doubles the array;
+that happens a handful of times per run, not per element.
+
+pop_unchecked / top_unchecked / isEmpty / size work as for StaticStack.
+*/
+template <typename T>
+struct ReservedStack {
+    T* items;
+    int top;          // Number of elements
+    int capacity;
+};
+
+template <typename T>
+void reserveStack(ReservedStack<T>* s, int capacity) {
+    s->items = new T[capacity];
+    s->top = 0;
+    s->capacity = capacity;
+}
+
+template <typename T>
+void clearStack(ReservedStack<T>* s) {
+    s->top = 0;
+}
+
+template <typename T>
+void destroyStack(ReservedStack<T>* s) {
+    delete[] s->items;
+    s->items = nullptr;
+    s->top = s->capacity = 0;
+}
+
+// Moves n elements into a bigger array: one memcpy when T allows it
+template <typename T>
+void moveItems(T* dest, T* src, int n, std::true_type /* trivially copyable */) {
+    memcpy(dest, src, n * sizeof(T));
+}
+
+template <typename T>
+void moveItems(T* dest, T* src, int n, std::false_type) {
+    for (int i = 0; i < n; i++)
+        dest[i] = std::move(src[i]);
+}
+
+// Never fails: a full stack doubles its array first
+template <typename T>
+void push(ReservedStack<T>* s, T value) {
+    if (s->top == s->capacity) {
+        T* bigger = new T[s->capacity * 2];
+        moveItems(bigger, s->items, s->top, typename std::is_trivially_copyable<T>::type());
+        delete[] s->items;
+        s->items = bigger;
+        s->capacity *= 2;
+    }
+    s->items[s->top++] = std::move(value);
+}
+
+template <typename T>
+bool isEmpty(const ReservedStack<T>* s) {
+    return s->top == 0;
+}
+
+template <typename T>
+int size(const ReservedStack<T>* s) {
+    return s->top;
+}
+
+// Unchecked: the caller guarantees the stack is not empty
+template <typename T>
+T pop_unchecked(ReservedStack<T>* s) {
+    return std::move(s->items[--s->top]);
+}
+
+template <typename T>
+T top_unchecked(const ReservedStack<T>* s) {
+    return s->items[s->top - 1];
+}
+
+#endif
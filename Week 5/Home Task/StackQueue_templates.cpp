@@ -1,8 +1,35 @@
 #include <iostream>
 #include <stdexcept>  // For exception handling
 #include <string>
+#include <utility>    // For std::move, std::forward, std::swap
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
 using namespace std;
 
+/*
+COPIES vs MOVES
+---------------
+The first version of push() was `void push(T value)` with `Node(T value)`:
+pushing a string copied it into the parameter, into the Node constructor's
+parameter, and into Node::data, and pop() copied it once more on the way
+out. For a 1 KB string each copy is a heap allocation plus a 1 KB memcpy.
+
+Now:
+  - push(const T&) copies exactly once (into the node)
+  - push(T&&) moves: the node steals the string's buffer, no allocation
+  - emplace(args...) builds the element directly inside the node
+  - pop()/dequeue() move the element out of the node before deleting it
+  - the containers themselves follow the "rule of five": copy constructor,
+    copy assignment, move constructor, move assignment and destructor are
+    all defined, so copying a Stack copies its elements and moving one just
+    hands over the node pointers
+
+Python has no equivalent: assigning a list never copies its elements.
+*/
+
 
 
 template <typename T>
@@ -12,7 +39,9 @@ private:
         T data;           
         Node* next;       
         
-        Node(T value) : data(value), next(nullptr) {}
+        // Builds data in place from whatever arguments were given
+        template <typename... Args>
+        explicit Node(Args&&... args) : data(forward<Args>(args)...), next(nullptr) {}
     };
     
     Node* topNode;        // Pointer to top of stack
@@ -27,24 +56,70 @@ public:
         */
     }
     
+    // Copy constructor - deep copy, same order
+    Stack(const Stack& other) : topNode(nullptr), stackSize(0) {
+        Node** link = &topNode;
+        for (Node* curr = other.topNode; curr != nullptr; curr = curr->next) {
+            *link = new Node(curr->data);
+            link = &(*link)->next;
+        }
+        stackSize = other.stackSize;
+    }
+    
+    // Move constructor - take over other's nodes, leave it empty
+    Stack(Stack&& other) noexcept : topNode(other.topNode), stackSize(other.stackSize) {
+        other.topNode = nullptr;
+        other.stackSize = 0;
+    }
+    
+    // Copy and move assignment (copy-and-swap: `other` is already a copy
+    // or a moved-from temporary, so we just swap with it)
+    Stack& operator=(Stack other) noexcept {
+        swap(topNode, other.topNode);
+        swap(stackSize, other.stackSize);
+        return *this;
+    }
+    
     // Destructor - Clean up memory
     ~Stack() {
-        while (!isEmpty()) {
-            pop();
-        }
+        clear();
         /*
         Python: def __del__(self):
                     # Python has garbage collection, no manual cleanup needed
         */
     }
     
-    // Push operation - Add element to top
+    // Delete every node (no element is copied or moved)
+    void clear() {
+        while (topNode != nullptr) {
+            Node* next = topNode->next;
+            delete topNode;
+            topNode = next;
+        }
+        stackSize = 0;
+    }
+    
+    // Construct a new top element in place: emplace(1024, 'x') for a string
     // Time Complexity: O(1)
-    void push(T value) {
-        Node* newNode = new Node(value);  // Create new node
-        newNode->next = topNode;          // Link to current top
-        topNode = newNode;                // Update top pointer
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        Node* newNode = new Node(forward<Args>(args)...);
+        newNode->next = topNode;
+        topNode = newNode;
         stackSize++;
+        return newNode->data;
+    }
+    
+    // Push a copy of value (one copy, into the node)
+    // Time Complexity: O(1)
+    void push(const T& value) {
+        emplace(value);
+    }
+    
+    // Push operation - Add element to top, moving value into the node
+    // Time Complexity: O(1)
+    void push(T&& value) {
+        emplace(move(value));             // The node steals value's contents
         
         /*
         Python equivalent:
@@ -59,6 +134,7 @@ public:
     }
     
     // Pop operation - Remove and return top element
+    // The element is moved out of the node, not copied
     // Time Complexity: O(1)
     T pop() {
         if (isEmpty()) {
@@ -66,7 +142,7 @@ public:
         }
         
         Node* temp = topNode;       // Save current top
-        T value = topNode->data;    // Save data to return
+        T value = move(topNode->data);  // Take the data to return
         topNode = topNode->next;    // Move top to next node
         delete temp;                // Free memory
         stackSize--;
@@ -82,9 +158,9 @@ public:
         */
     }
     
-    // Peek/Top - Return top element without removing
+    // Peek/Top - Return top element without removing (by reference: no copy)
     // Time Complexity: O(1)
-    T top() const {
+    const T& top() const {
         if (isEmpty()) {
             throw runtime_error("Stack is empty");
         }
@@ -161,13 +237,25 @@ private:
         T data;
         Node* next;
         
-        Node(T value) : data(value), next(nullptr) {}
+        template <typename... Args>
+        explicit Node(Args&&... args) : data(forward<Args>(args)...), next(nullptr) {}
     };
     
     Node* frontNode;      // Pointer to front of queue
     Node* rearNode;       // Pointer to rear of queue
     int queueSize;        // Current number of elements
     
+    // Link an already-built node at the rear
+    void linkRear(Node* newNode) {
+        if (isEmpty()) {
+            frontNode = rearNode = newNode;
+        } else {
+            rearNode->next = newNode;
+            rearNode = newNode;
+        }
+        queueSize++;
+    }
+    
 public:
     // Constructor
     Queue() : frontNode(nullptr), rearNode(nullptr), queueSize(0) {
@@ -177,27 +265,61 @@ public:
         */
     }
     
+    // Copy constructor - deep copy, same order
+    Queue(const Queue& other) : frontNode(nullptr), rearNode(nullptr), queueSize(0) {
+        for (Node* curr = other.frontNode; curr != nullptr; curr = curr->next)
+            linkRear(new Node(curr->data));
+    }
+    
+    // Move constructor - take over other's nodes, leave it empty
+    Queue(Queue&& other) noexcept
+        : frontNode(other.frontNode), rearNode(other.rearNode), queueSize(other.queueSize) {
+        other.frontNode = other.rearNode = nullptr;
+        other.queueSize = 0;
+    }
+    
+    // Copy and move assignment (copy-and-swap)
+    Queue& operator=(Queue other) noexcept {
+        swap(frontNode, other.frontNode);
+        swap(rearNode, other.rearNode);
+        swap(queueSize, other.queueSize);
+        return *this;
+    }
+    
     // Destructor
     ~Queue() {
-        while (!isEmpty()) {
-            dequeue();
+        clear();
+    }
+    
+    // Delete every node (no element is copied or moved)
+    void clear() {
+        while (frontNode != nullptr) {
+            Node* next = frontNode->next;
+            delete frontNode;
+            frontNode = next;
         }
+        rearNode = nullptr;
+        queueSize = 0;
     }
     
-    // Enqueue operation - Add element to rear
+    // Construct a new rear element in place
     // Time Complexity: O(1)
-    void enqueue(T value) {
-        Node* newNode = new Node(value);
-        
-        if (isEmpty()) {
-            // First element - both front and rear point to it
-            frontNode = rearNode = newNode;
-        } else {
-            // Add to rear
-            rearNode->next = newNode;
-            rearNode = newNode;
-        }
-        queueSize++;
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        Node* newNode = new Node(forward<Args>(args)...);
+        linkRear(newNode);
+        return newNode->data;
+    }
+    
+    // Enqueue a copy of value (one copy, into the node)
+    void enqueue(const T& value) {
+        emplace(value);
+    }
+    
+    // Enqueue operation - Add element to rear, moving value into the node
+    // Time Complexity: O(1)
+    void enqueue(T&& value) {
+        emplace(move(value));             // The node steals value's contents
         
         /*
         Python equivalent:
@@ -219,7 +341,7 @@ public:
         }
         
         Node* temp = frontNode;
-        T value = frontNode->data;
+        T value = move(frontNode->data);  // Move out, don't copy
         frontNode = frontNode->next;
         
         // If queue becomes empty, update rear too
@@ -247,9 +369,9 @@ public:
         */
     }
     
-    // Front - Return front element without removing
+    // Front - Return front element without removing (by reference: no copy)
     // Time Complexity: O(1)
-    T front() const {
+    const T& front() const {
         if (isEmpty()) {
             throw runtime_error("Queue is empty");
         }
@@ -265,7 +387,7 @@ public:
     
     // Rear - Return rear element without removing
     // Time Complexity: O(1)
-    T rear() const {
+    const T& rear() const {
         if (isEmpty()) {
             throw runtime_error("Queue is empty");
         }
@@ -455,11 +577,166 @@ void demonstrateApplications() {
     }
 }
 
+void demonstrateMoveSemantics() {
+    cout << "\n========== MOVE SEMANTICS AND EMPLACE ==========" << endl;
+    
+    Stack<string> stack;
+    string word = "moved";
+    stack.push(word);                 // Copy: word is still usable
+    stack.push(move(word));           // Move: word is now empty
+    stack.emplace(3, '!');            // Built in place: "!!!"
+    cout << "\n1. After push(copy), push(move), emplace(3, '!'):" << endl;
+    cout << "   word is now \"" << word << "\"" << endl;
+    stack.display();
+    
+    Stack<string> copy = stack;       // Copy constructor: deep copy
+    Stack<string> taken = move(stack);  // Move constructor: no element copied
+    cout << "\n2. Copied and then moved the stack:" << endl;
+    cout << "   copy size " << copy.size() << ", taken size " << taken.size()
+         << ", original size " << stack.size() << endl;
+    
+    Queue<string> queue;
+    queue.emplace("first");
+    queue.enqueue(string("second"));
+    Queue<string> other;
+    other = queue;                    // Copy assignment
+    cout << "\n3. Queue copy-assigned, dequeued from the copy: " << other.dequeue() << endl;
+    cout << "   Original front still: " << queue.front() << endl;
+}
+
+//==============================================================================
+// BENCHMARK: ALLOCATIONS PER OPERATION WITH 1 KB STRINGS
+//==============================================================================
+
+/*
+Built with -DCOUNT_ALLOCATIONS, every `new` in the program (including
+std::string's buffer) goes through this replacement operator new, so the
+benchmark can count allocations per operation. A normal build keeps the
+standard operator new and the benchmark only reports times.
+*/
+#ifdef COUNT_ALLOCATIONS
+long long allocationCount = 0;
+
+void* operator new(size_t size) {
+    allocationCount++;
+    void* p = malloc(size == 0 ? 1 : size);
+    if (p == nullptr) throw bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+#endif
+
+/*
+The original by-value Stack, kept only to measure against.
+*/
+template <typename T>
+class CopyingStack {
+    struct Node {
+        T data;
+        Node* next;
+        Node(T value) : data(value), next(nullptr) {}
+    };
+    Node* topNode = nullptr;
+    
+public:
+    ~CopyingStack() { while (topNode != nullptr) pop(); }
+    
+    void push(T value) {
+        Node* newNode = new Node(value);
+        newNode->next = topNode;
+        topNode = newNode;
+    }
+    
+    T pop() {
+        Node* temp = topNode;
+        T value = topNode->data;
+        topNode = topNode->next;
+        delete temp;
+        return value;
+    }
+};
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+Each operation builds a fresh 1 KB payload (1 allocation, counted),
+pushes it onto an empty container and pops it back off.
+*/
+template <typename PushPop>
+void measure(const char* name, PushPop pushPop) {
+    const int ops = 200000;
+    size_t checksum = 0;
+#ifdef COUNT_ALLOCATIONS
+    long long before = allocationCount;
+#endif
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++)
+        checksum += pushPop(i);
+    double elapsed = secondsSince(start);
+#ifdef COUNT_ALLOCATIONS
+    printf("%-34s | %11.2f | %9.0f\n", name,
+           (double)(allocationCount - before) / ops, elapsed / ops * 1e9);
+#else
+    printf("%-34s | %11s | %9.0f\n", name, "-", elapsed / ops * 1e9);
+#endif
+    if (checksum == 0)
+        cout << "Error: nothing was popped" << endl;
+}
+
+void benchmark() {
+    const size_t payload = 1024;
+    
+    cout << "\n1 KB string payload, one push + one pop per operation\n\n";
+    cout << "Operation                          | Allocs / op | ns / op\n";
+    cout << "-----------------------------------|-------------|--------\n";
+    
+    CopyingStack<string> old;
+    measure("Old Stack: push(T) + pop() copy", [&](int i) {
+        string s(payload, 'a' + i % 26);
+        old.push(s);
+        return old.pop().size();
+    });
+    
+    Stack<string> stack;
+    measure("Stack: push(const T&) + pop()", [&](int i) {
+        string s(payload, 'a' + i % 26);
+        stack.push(s);
+        return stack.pop().size();
+    });
+    measure("Stack: push(T&&) + pop()", [&](int i) {
+        string s(payload, 'a' + i % 26);
+        stack.push(move(s));
+        return stack.pop().size();
+    });
+    measure("Stack: emplace(1024, c) + pop()", [&](int i) {
+        stack.emplace(payload, 'a' + i % 26);
+        return stack.pop().size();
+    });
+    
+    Queue<string> queue;
+    measure("Queue: enqueue(T&&) + dequeue()", [&](int i) {
+        string s(payload, 'a' + i % 26);
+        queue.enqueue(move(s));
+        return queue.dequeue().size();
+    });
+    
+#ifdef COUNT_ALLOCATIONS
+    cout << "\n(1 of the allocations per operation is building the payload itself,\n"
+         << " 1 is the node; everything above 2 is a copy of the string.)\n";
+#else
+    cout << "\n(Rebuild with -DCOUNT_ALLOCATIONS to count allocations per operation.)\n";
+#endif
+}
+
 //==============================================================================
 // MAIN FUNCTION
 //==============================================================================
 
-int main() {
+int main(int argc, char* argv[]) {
     cout << "==================================================" << endl;
     cout << "  STACK AND QUEUE USING C++ TEMPLATES" << endl;
     cout << "  Data Structures Course - Educational Demo" << endl;
@@ -469,6 +746,7 @@ int main() {
         demonstrateStack();
         demonstrateQueue();
         demonstrateApplications();
+        demonstrateMoveSemantics();
         
         cout << "\n==================================================" << endl;
         cout << "  All demonstrations completed successfully!" << endl;
@@ -479,6 +757,9 @@ int main() {
         return 1;
     }
     
+    // ./stack_queue bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
     return 0;
 }
 
@@ -504,6 +785,9 @@ KEY CONCEPTS SUMMARY
 
 4. MEMORY MANAGEMENT:
    - C++: Manual (new/delete) - must implement destructor
+   - Rule of five: a class that owns memory defines destructor, copy
+     constructor/assignment and move constructor/assignment
+   - push(T&&), emplace(...) and move-out pop() avoid copying elements
    - Python: Automatic garbage collection
 
 5. EXCEPTION HANDLING:
@@ -518,6 +802,10 @@ To compile and run this program:
 
     g++ -std=c++11 stack_queue_templates.cpp -o stack_queue
     ./stack_queue
+    ./stack_queue bench     (time per operation, 1 KB strings)
+
+    g++ -std=c++11 -DCOUNT_ALLOCATIONS stack_queue_templates.cpp -o stack_queue
+    ./stack_queue bench     (also counts allocations per operation)
 
 Expected Output:
     - Stack demonstrations with different data types
@@ -0,0 +1,67 @@
+#ifndef LINKED_QUEUE_BASELINE_H
+#define LINKED_QUEUE_BASELINE_H
+
+/*
+LINKED QUEUE BASELINE
+---------------------
+The task 2 linked-list queue (task2_linked_queue.cpp) cut down to what the
+benchmarks need: one `new` per enqueue, one `delete` per dequeue, no
+printing. task1_circular_queue.cpp and task2_chunked_queue.cpp both
+measure against it; it lives here because every task has its own main()
+and so cannot include another task's .cpp.
+*/
+template <typename T>
+struct QueueNode {
+    T data;
+    QueueNode<T>* next;
+};
+
+template <typename T>
+struct LinkedQueue {
+    QueueNode<T>* front;
+    QueueNode<T>* rear;
+    int size;
+};
+
+template <typename T>
+void initQueue(LinkedQueue<T>* queue) {
+    queue->front = nullptr;
+    queue->rear = nullptr;
+    queue->size = 0;
+}
+
+template <typename T>
+void enqueue(LinkedQueue<T>* queue, T value) {
+    QueueNode<T>* newNode = new QueueNode<T>;
+    newNode->data = value;
+    newNode->next = nullptr;
+    if (queue->rear == nullptr) {
+        queue->front = newNode;
+        queue->rear = newNode;
+    } else {
+        queue->rear->next = newNode;
+        queue->rear = newNode;
+    }
+    queue->size++;
+}
+
+// The caller checks the queue is not empty
+template <typename T>
+T dequeue(LinkedQueue<T>* queue) {
+    QueueNode<T>* temp = queue->front;
+    T value = temp->data;
+    queue->front = temp->next;
+    if (queue->front == nullptr)
+        queue->rear = nullptr;
+    delete temp;
+    queue->size--;
+    return value;
+}
+
+template <typename T>
+void destroyQueue(LinkedQueue<T>* queue) {
+    while (queue->front != nullptr)
+        dequeue(queue);
+}
+
+#endif
@@ -0,0 +1,427 @@
+/*
+================================================================================
+PARALLEL BRACKET-BALANCE CHECKER
+================================================================================
+
+balancedParenthesesDemo() (stack_queue_procedural.cpp) walks the text one
+character at a time with a stack. That is inherently sequential: whether
+a ')' at position 1,000,000 matches depends on everything before it.
+
+SPLITTING THE WORK
+------------------
+Each thread still runs the normal stack algorithm, but on its own chunk.
+Whatever it cannot match inside the chunk is what matters to its
+neighbours, and it has a fixed shape:
+
+    unmatched CLOSES (they need an opener from an earlier chunk)
+  + unmatched OPENS  (they need a closer from a later chunk)
+
+    chunk 1: "{ [ ( a ) "     -> closes: ""     opens: "{["
+    chunk 2: "b ] , [ c"      -> closes: "]"    opens: "["
+    chunk 3: "] }"            -> closes: "]}"   opens: ""
+
+A chunk can also be broken on its own ("(]" inside one chunk); then the
+whole input is unbalanced no matter what the other chunks say.
+
+COMBINE (left to right, one small stack):
+    stack = ""
+    chunk 1: no closes;        push "{["        stack = "{["
+    chunk 2: "]" matches '[';  push "["         stack = "{["
+    chunk 3: "]}" match "[{";  nothing to push  stack = ""   -> BALANCED
+
+The combine step only touches unmatched brackets, which is tiny next to
+the chunks themselves, so the chunks can be reduced in parallel.
+
+SKIPPING NON-BRACKETS (SSE2)
+----------------------------
+Most bytes of a log are not brackets. The scanner loads 16 bytes at a
+time, compares them against all six bracket characters at once and gets
+a 16-bit mask of where the brackets are. A zero mask (the common case)
+skips all 16 bytes with a handful of instructions. Without SSE2 (non-x86
+targets) reduceChunk falls back to the scalar scan.
+
+Brackets inside JSON string literals are counted like any others: telling
+whether a chunk starts inside a string would need its own pass.
+
+Usage:
+    ./parallel_brackets                 demo
+    ./parallel_brackets file [threads]  check a file (read in 256 MB segments)
+    ./parallel_brackets bench [MB]      benchmark on generated JSON-like text
+Compile: g++ -std=c++11 -O2 -pthread parallel_brackets.cpp
+*/
+
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef __SSE2__
+#include <emmintrin.h>   // SSE2
+#endif
+using namespace std;
+
+//==============================================================================
+// BRACKET HELPERS
+//==============================================================================
+
+bool isOpen(char c) {
+    return c == '(' || c == '[' || c == '{';
+}
+
+bool isClose(char c) {
+    return c == ')' || c == ']' || c == '}';
+}
+
+char openerFor(char close) {
+    return close == ')' ? '(' : close == ']' ? '[' : '{';
+}
+
+//==============================================================================
+// SEQUENTIAL BASELINE: ONE STACK, ONE CHARACTER AT A TIME
+//==============================================================================
+
+/*
+The algorithm of balancedParenthesesDemo()/isBalanced(), extended to all
+three bracket types, on a whole buffer.
+*/
+bool isBalancedSequential(const char* text, size_t n) {
+    vector<char> stack;
+    for (size_t i = 0; i < n; i++) {
+        char c = text[i];
+        if (isOpen(c)) {
+            stack.push_back(c);
+        } else if (isClose(c)) {
+            if (stack.empty() || stack.back() != openerFor(c))
+                return false;
+            stack.pop_back();
+        }
+    }
+    return stack.empty();
+}
+
+//==============================================================================
+// CHUNK SIGNATURE
+//==============================================================================
+
+struct ChunkSignature {
+    vector<char> closes;   // Unmatched closers, in text order
+    vector<char> opens;    // Unmatched openers (used as the chunk's stack)
+    bool broken;           // "(]" inside the chunk: unbalanced for sure
+};
+
+void resetSignature(ChunkSignature* sig) {
+    sig->closes.clear();
+    sig->opens.clear();
+    sig->broken = false;
+}
+
+// One bracket character: the same stack step as the sequential version
+inline void reduceBracket(ChunkSignature* sig, char c) {
+    if (isOpen(c)) {
+        sig->opens.push_back(c);
+    } else if (sig->opens.empty()) {
+        sig->closes.push_back(c);          // Needs an opener from earlier
+    } else if (sig->opens.back() == openerFor(c)) {
+        sig->opens.pop_back();
+    } else {
+        sig->broken = true;
+    }
+}
+
+// Scalar scan: every byte goes through the bracket test
+void reduceChunkScalar(const char* p, size_t n, ChunkSignature* sig) {
+    resetSignature(sig);
+    for (size_t i = 0; i < n && !sig->broken; i++) {
+        char c = p[i];
+        if (isOpen(c) || isClose(c))
+            reduceBracket(sig, c);
+    }
+}
+
+/*
+SSE2 scan: 16 bytes per step.
+
+    bytes:  a  :  [  1  ,  2  ]  ,  "  x  "  :  {  }  ,  ...
+    mask:   0  0  1  0  0  0  1  0  0  0  0  0  1  1  0  ...
+
+Only the set bits are visited (lowest first, so text order is kept).
+*/
+#ifdef __SSE2__
+// Index of the lowest set bit of a non-zero mask
+inline int lowestBit(unsigned mask) {
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    int bit = 0;
+    while ((mask & 1u) == 0) {
+        mask >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+void reduceChunk(const char* p, size_t n, ChunkSignature* sig) {
+    resetSignature(sig);
+    const __m128i roundOpen  = _mm_set1_epi8('('), roundClose  = _mm_set1_epi8(')');
+    const __m128i squareOpen = _mm_set1_epi8('['), squareClose = _mm_set1_epi8(']');
+    const __m128i curlyOpen  = _mm_set1_epi8('{'), curlyClose  = _mm_set1_epi8('}');
+
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i hits = _mm_or_si128(
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, roundOpen), _mm_cmpeq_epi8(bytes, roundClose)),
+                         _mm_or_si128(_mm_cmpeq_epi8(bytes, squareOpen), _mm_cmpeq_epi8(bytes, squareClose))),
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, curlyOpen), _mm_cmpeq_epi8(bytes, curlyClose)));
+        unsigned mask = (unsigned)_mm_movemask_epi8(hits);
+        while (mask != 0) {
+            reduceBracket(sig, p[i + lowestBit(mask)]);
+            mask &= mask - 1;                  // Clear the lowest set bit
+        }
+        if (sig->broken) return;
+    }
+    for (; i < n; i++) {                       // Last 0-15 bytes
+        char c = p[i];
+        if (isOpen(c) || isClose(c))
+            reduceBracket(sig, c);
+    }
+}
+#else
+void reduceChunk(const char* p, size_t n, ChunkSignature* sig) {
+    reduceChunkScalar(p, n, sig);
+}
+#endif
+
+//==============================================================================
+// COMBINE
+//==============================================================================
+
+/*
+Folds one chunk's signature into the running stack of openers that are
+still waiting for a closer. Returns false as soon as the input is known
+to be unbalanced. Chunks must be folded in text order.
+*/
+bool combineSignature(vector<char>* pending, const ChunkSignature* sig) {
+    if (sig->broken)
+        return false;
+    for (char c : sig->closes) {
+        if (pending->empty() || pending->back() != openerFor(c))
+            return false;
+        pending->pop_back();
+    }
+    pending->insert(pending->end(), sig->opens.begin(), sig->opens.end());
+    return true;
+}
+
+/*
+Splits [text, text + n) into one chunk per thread, reduces them in
+parallel and folds the signatures into *pending. The caller decides at
+the very end whether pending is empty; this lets checkFile() feed a huge
+file through in segments.
+*/
+bool checkSegment(const char* text, size_t n, int threads, vector<char>* pending,
+                  vector<ChunkSignature>* signatures) {
+    signatures->resize(threads);
+    size_t chunk = (n + threads - 1) / threads;
+    vector<thread> workers;
+
+    for (int t = 0; t < threads; t++) {
+        size_t begin = min(n, t * chunk), end = min(n, begin + chunk);
+        ChunkSignature* sig = &(*signatures)[t];
+        if (t == threads - 1) {
+            reduceChunk(text + begin, end - begin, sig);   // This thread does the last one
+        } else {
+            workers.push_back(thread([text, begin, end, sig]() {
+                reduceChunk(text + begin, end - begin, sig);
+            }));
+        }
+    }
+    for (thread& w : workers) w.join();
+
+    for (int t = 0; t < threads; t++) {
+        if (!combineSignature(pending, &(*signatures)[t]))
+            return false;
+    }
+    return true;
+}
+
+bool isBalancedParallel(const char* text, size_t n, int threads) {
+    vector<char> pending;
+    vector<ChunkSignature> signatures;
+    return checkSegment(text, n, threads, &pending, &signatures) && pending.empty();
+}
+
+/*
+A multi-GB file does not have to fit in memory: it is read in 256 MB
+segments, and the pending stack carries the unmatched openers from one
+segment to the next.
+*/
+const size_t SEGMENT = 256 << 20;
+
+bool checkFile(FILE* in, int threads, long long* bytes) {
+    char* buffer = new char[SEGMENT];
+    vector<char> pending;
+    vector<ChunkSignature> signatures;
+    bool balanced = true;
+    size_t got;
+    *bytes = 0;
+
+    while (balanced && (got = fread(buffer, 1, SEGMENT, in)) > 0) {
+        *bytes += got;
+        balanced = checkSegment(buffer, got, threads, &pending, &signatures);
+    }
+    delete[] buffer;
+    return balanced && pending.empty();
+}
+
+//==============================================================================
+// DEMONSTRATION
+//==============================================================================
+
+void demonstrate() {
+    cout << "\n====================================================\n";
+    cout << "  PARALLEL BRACKET CHECK (chunk signatures)\n";
+    cout << "====================================================\n\n";
+
+    string text = "{ [ ( a ) b ] , [ c ] }";
+    size_t cuts[] = {0, 9, 17, text.size()};   // Three uneven chunks
+    vector<char> pending;
+
+    cout << "Text: " << text << "\n\n";
+    for (int c = 0; c < 3; c++) {
+        ChunkSignature sig;
+        reduceChunk(text.data() + cuts[c], cuts[c + 1] - cuts[c], &sig);
+        bool ok = combineSignature(&pending, &sig);
+        printf("  chunk %d \"%s\"  closes: \"%s\"  opens: \"%s\"  -> pending \"%s\"%s\n",
+               c + 1, text.substr(cuts[c], cuts[c + 1] - cuts[c]).c_str(),
+               string(sig.closes.begin(), sig.closes.end()).c_str(),
+               string(sig.opens.begin(), sig.opens.end()).c_str(),
+               string(pending.begin(), pending.end()).c_str(), ok ? "" : "  MISMATCH");
+    }
+    cout << "\nBalanced: " << (pending.empty() ? "yes" : "no") << "\n\n";
+
+    const char* samples[] = {"((a+b)*c)", "((a+b)*c", "{a[i] * (b - c)}", "(a[i)]", "}{"};
+    for (const char* s : samples) {
+        size_t n = strlen(s);
+        printf("  %-18s sequential: %-3s  parallel (4 chunks): %s\n", s,
+               isBalancedSequential(s, n) ? "yes" : "no",
+               isBalancedParallel(s, n, 4) ? "yes" : "no");
+    }
+}
+
+//==============================================================================
+// BENCHMARK
+//==============================================================================
+
+uint64_t nextRandom(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// JSON-like log lines: nested objects and arrays, mostly plain text
+string makeLogText(size_t bytes) {
+    const char* words[] = {"request", "served", "cache", "miss", "upstream", "timeout",
+                           "user", "session", "ok", "retry"};
+    string text;
+    text.reserve(bytes + 512);
+    uint64_t state = 0xC0FFEEull;
+    char line[512];
+
+    while (text.size() < bytes) {
+        int len = sprintf(line, "{\"id\": %llu, \"tags\": [\"%s\", \"%s\"], \"ctx\": {\"pos\": [%d, %d, {\"z\": %d}]}, \"msg\": \"",
+                          (unsigned long long)(nextRandom(&state) % 1000000000),
+                          words[nextRandom(&state) % 10], words[nextRandom(&state) % 10],
+                          (int)(nextRandom(&state) % 100), (int)(nextRandom(&state) % 100),
+                          (int)(nextRandom(&state) % 100));
+        int wordsInMsg = 8 + nextRandom(&state) % 16;
+        for (int w = 0; w < wordsInMsg; w++)
+            len += sprintf(line + len, "%s ", words[nextRandom(&state) % 10]);
+        len += sprintf(line + len, "\"}\n");
+        text.append(line, len);
+    }
+    return text;
+}
+
+void benchmark(size_t megabytes) {
+    string text = makeLogText(megabytes << 20);
+    double gb = text.size() / 1e9;
+    const int threadCounts[] = {1, 2, 4, 8};
+
+    cout << "\n" << text.size() / 1048576 << " MB of JSON-like log lines, "
+         << thread::hardware_concurrency() << " hardware threads\n\n";
+    cout << "Checker                         | GB/sec | Balanced\n";
+    cout << "--------------------------------|--------|---------\n";
+
+    auto start = chrono::steady_clock::now();
+    bool result = isBalancedSequential(text.data(), text.size());
+    printf("%-31s | %6.2f | %s\n", "Sequential stack (per char)", gb / secondsSince(start),
+           result ? "yes" : "no");
+
+    ChunkSignature sig;
+    start = chrono::steady_clock::now();
+    reduceChunkScalar(text.data(), text.size(), &sig);
+    double scalarTime = secondsSince(start);
+    printf("%-31s | %6.2f | %s\n", "Signature, scalar, 1 thread", gb / scalarTime,
+           !sig.broken && sig.closes.empty() && sig.opens.empty() ? "yes" : "no");
+
+    for (int threads : threadCounts) {
+        start = chrono::steady_clock::now();
+        result = isBalancedParallel(text.data(), text.size(), threads);
+        char name[64];
+#ifdef __SSE2__
+        const char* scan = "SSE2";
+#else
+        const char* scan = "scalar";
+#endif
+        sprintf(name, "Signature, %s, %d thread%s", scan, threads, threads > 1 ? "s" : "");
+        printf("%-31s | %6.2f | %s\n", name, gb / secondsSince(start), result ? "yes" : "no");
+    }
+
+    // One stray closer in the middle must be found by every version
+    text[text.size() / 2] = ']';
+    printf("\nWith a stray ']' in the middle: sequential %s, parallel (4) %s\n",
+           isBalancedSequential(text.data(), text.size()) ? "balanced" : "unbalanced",
+           isBalancedParallel(text.data(), text.size(), 4) ? "balanced" : "unbalanced");
+}
+
+//==============================================================================
+// MAIN FUNCTION
+//==============================================================================
+
+int main(int argc, char* argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+        benchmark(argc >= 3 ? atoll(argv[2]) : 512);
+    } else if (argc >= 2) {
+        FILE* in = fopen(argv[1], "rb");
+        if (in == nullptr) {
+            cout << "Error: cannot open " << argv[1] << endl;
+            return 1;
+        }
+        int threads = argc >= 3 ? atoi(argv[2]) : (int)thread::hardware_concurrency();
+        if (threads < 1) threads = 1;
+        long long bytes;
+        auto start = chrono::steady_clock::now();
+        bool balanced = checkFile(in, threads, &bytes);
+        double elapsed = secondsSince(start);
+        fclose(in);
+        printf("%s: %s (%lld bytes checked, %.2f GB/sec, %d threads)\n", argv[1],
+               balanced ? "balanced" : "NOT balanced", bytes, bytes / 1e9 / elapsed, threads);
+        return balanced ? 0 : 2;
+    } else {
+        demonstrate();
+    }
+    return 0;
+}
@@ -1,5 +1,10 @@
 #include <iostream>
 #include <cstdlib>  
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
 using namespace std;
 
 template <typename T>
@@ -369,6 +374,127 @@ void destroyQueue(Queue<T>* queue) {
     }
 }
 
+//==============================================================================
+// PART 4B: ARRAY-BACKED STACK WITH A SMALL INLINE BUFFER
+//==============================================================================
+
+/*
+SMALL STACK
+-----------
+The linked Stack above does `new StackNode` on every push and `delete` on
+every pop. Most stacks in practice are shallow (a bracket checker rarely
+goes more than a few levels deep), so SmallStack keeps the elements in an
+ARRAY and starts with an array stored inside the struct itself:
+
+    SmallStack<char, 16> s;     // lives on the function's stack frame
+
+    s.data ──┐
+             v
+    buffer: [ ( ][ [ ][ { ][   ][   ] ... [   ]    (16 slots, no heap)
+                         ^size = 3
+
+Only when the 17th element is pushed does it move to a heap array twice
+the size, and from then on it doubles whenever it is full (geometric
+growth, so push is amortized O(1)):
+
+    buffer (unused now)       data ──> heap: [ ... 32 slots ... ]
+
+Push and pop are just `data[size++] = x` / `data[--size]`: no allocation,
+and the elements sit next to each other in memory.
+
+NOTE: `data` may point into the struct's own buffer, so a SmallStack must
+not be copied with `=` (the copy would point at the original's buffer).
+Pass it by pointer like every other stack in this file.
+*/
+template <typename T, int INLINE_CAPACITY = 16>
+struct SmallStack {
+    T* data;                       // buffer, or a heap array after growing
+    int size;                      // Number of elements
+    int capacity;                  // Slots available in data
+    T buffer[INLINE_CAPACITY];     // Inline storage for shallow stacks
+};
+
+template <typename T, int N>
+void initStack(SmallStack<T, N>* stack) {
+    stack->data = stack->buffer;
+    stack->size = 0;
+    stack->capacity = N;
+}
+
+// Doubles the capacity, moving the elements to a new heap array
+template <typename T, int N>
+void growStack(SmallStack<T, N>* stack) {
+    int newCapacity = stack->capacity * 2;
+    T* newData = new T[newCapacity];
+    for (int i = 0; i < stack->size; i++)
+        newData[i] = move(stack->data[i]);
+    if (stack->data != stack->buffer)
+        delete[] stack->data;
+    stack->data = newData;
+    stack->capacity = newCapacity;
+}
+
+template <typename T, int N>
+void push(SmallStack<T, N>* stack, T value) {
+    if (stack->size == stack->capacity)
+        growStack(stack);
+    stack->data[stack->size++] = move(value);
+}
+
+template <typename T, int N>
+T pop(SmallStack<T, N>* stack) {
+    if (stack->size == 0) {
+        cout << "Error: Stack Underflow - Cannot pop from empty stack!" << endl;
+        exit(1);
+    }
+    return move(stack->data[--stack->size]);
+}
+
+template <typename T, int N>
+T peek(SmallStack<T, N>* stack) {
+    if (stack->size == 0) {
+        cout << "Error: Stack is empty!" << endl;
+        exit(1);
+    }
+    return stack->data[stack->size - 1];
+}
+
+template <typename T, int N>
+bool isEmpty(SmallStack<T, N>* stack) {
+    return stack->size == 0;
+}
+
+template <typename T, int N>
+int getSize(SmallStack<T, N>* stack) {
+    return stack->size;
+}
+
+// True once the stack has outgrown its inline buffer
+template <typename T, int N>
+bool usesHeap(SmallStack<T, N>* stack) {
+    return stack->data != stack->buffer;
+}
+
+template <typename T, int N>
+void displayStack(SmallStack<T, N>* stack) {
+    if (isEmpty(stack)) {
+        cout << "Stack is empty" << endl;
+        return;
+    }
+    cout << "Stack (top to bottom): ";
+    for (int i = stack->size - 1; i >= 0; i--)
+        cout << stack->data[i] << " ";
+    cout << endl;
+}
+
+// Frees the heap array if there is one; the inline buffer needs nothing
+template <typename T, int N>
+void destroyStack(SmallStack<T, N>* stack) {
+    if (stack->data != stack->buffer)
+        delete[] stack->data;
+    initStack(stack);
+}
+
 //==============================================================================
 // PART 5: DEMONSTRATIONS AND APPLICATIONS
 //==============================================================================
@@ -495,42 +621,119 @@ void reverseStringDemo() {
     destroyStack(&charStack);
 }
 
+/*
+BALANCED BRACKETS CHECK
+Each opening bracket is pushed; each closing bracket must match the one on
+top. Uses a SmallStack, so for anything nested less than 16 deep the whole
+check runs without a single heap allocation.
+*/
+bool isBalanced(const string& expr) {
+    SmallStack<char, 16> stack;
+    initStack(&stack);
+    bool balanced = true;
+    
+    for (size_t i = 0; i < expr.length() && balanced; i++) {
+        char ch = expr[i];
+        if (ch == '(' || ch == '[' || ch == '{') {
+            push(&stack, ch);
+        }
+        else if (ch == ')' || ch == ']' || ch == '}') {
+            char open = ch == ')' ? '(' : ch == ']' ? '[' : '{';
+            if (isEmpty(&stack) || pop(&stack) != open)
+                balanced = false;
+        }
+    }
+    
+    if (!isEmpty(&stack)) balanced = false;
+    destroyStack(&stack);
+    return balanced;
+}
+
 // Application: Check balanced parentheses
 void balancedParenthesesDemo() {
     cout << "\n========================================" << endl;
     cout << "    APPLICATION: Balanced Parentheses" << endl;
     cout << "========================================\n" << endl;
     
-    string expr1 = "((a+b)*c)";
-    string expr2 = "((a+b)*c";
+    string expressions[] = {"((a+b)*c)", "((a+b)*c", "{a[i] * (b - c)}", "(a[i)]"};
     
-    // Check expression 1
-    Stack<char> stack1;
-    initStack(&stack1);
-    bool balanced = true;
-    
-    cout << "Expression: " << expr1 << endl;
+    for (const string& expr : expressions) {
+        cout << "Expression: " << expr << endl;
+        cout << "Result: " << (isBalanced(expr) ? "Balanced ✓" : "Not Balanced ✗") << endl;
+    }
     
-    for (int i = 0; i < expr1.length(); i++) {
-        if (expr1[i] == '(') {
-            push(&stack1, '(');
-        }
-        else if (expr1[i] == ')') {
-            if (isEmpty(&stack1)) {
-                balanced = false;
-                break;
-            }
-            pop(&stack1);
-        }
+    // Deeper than the inline buffer: the stack moves to the heap
+    SmallStack<int, 16> deep;
+    initStack(&deep);
+    for (int i = 0; i < 20; i++) {
+        push(&deep, i);
+        if (i == 15 || i == 16)
+            cout << "After " << i + 1 << " pushes: capacity " << deep.capacity
+                 << (usesHeap(&deep) ? " (heap)" : " (inline buffer)") << endl;
     }
+    destroyStack(&deep);
+}
+
+//==============================================================================
+// BENCHMARK: SMALL STACK vs LINKED STACK
+//==============================================================================
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+Pushes `depth` ints then pops them all, repeated until `total` pushes have
+been done. Returns millions of push+pop pairs per second.
+*/
+template <typename S>
+double pushPopRate(int depth, long long total) {
+    S stack;
+    initStack(&stack);
+    long long sum = 0;
+    long long rounds = total / depth;
+    
+    auto start = chrono::steady_clock::now();
+    for (long long r = 0; r < rounds; r++) {
+        for (int i = 0; i < depth; i++)
+            push(&stack, i);
+        for (int i = 0; i < depth; i++)
+            sum += pop(&stack);
+    }
+    double elapsed = secondsSince(start);
     
-    if (!isEmpty(&stack1)) balanced = false;
-    cout << "Result: " << (balanced ? "Balanced ✓" : "Not Balanced ✗") << endl;
+    destroyStack(&stack);
+    if (sum != rounds * ((long long)depth * (depth - 1) / 2))
+        cout << "Error: wrong checksum" << endl;
+    return rounds * depth / elapsed / 1e6;
+}
+
+void benchmark() {
+    const int depths[] = {4, 16, 64, 1024, 1000000};
+    const long long total = 20000000;
+    
+    cout << "\n" << total << " push+pop pairs of ints (M pairs/sec)\n\n";
+    cout << "  Depth | Linked Stack | SmallStack<int,16>\n";
+    cout << "--------|--------------|-------------------\n";
+    for (int depth : depths) {
+        double linked = pushPopRate<Stack<int> >(depth, total);
+        double small = pushPopRate<SmallStack<int, 16> >(depth, total);
+        printf("%7d | %12.1f | %18.1f\n", depth, linked, small);
+    }
     
-    destroyStack(&stack1);
+    // The bracket checker itself, on a 4-deep expression
+    string expr = "{a[i] * (b - (c + d))}";
+    const int checks = 2000000;
+    int balancedCount = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < checks; i++)
+        balancedCount += isBalanced(expr);
+    double elapsed = secondsSince(start);
+    printf("\nisBalanced(\"%s\"): %.1f M checks/sec, no heap allocations\n",
+           expr.c_str(), balancedCount / elapsed / 1e6);
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     cout << "================================================" << endl;
     cout << "  STACK & QUEUE - Procedural Implementation" << endl;
     cout << "  Using Templates, Pointers, and Dynamic Memory" << endl;
@@ -545,5 +748,8 @@ int main() {
     cout << "  All demonstrations completed!" << endl;
     cout << "================================================\n" << endl;
     
+    // ./stack_queue_procedural bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
     return 0;
 }
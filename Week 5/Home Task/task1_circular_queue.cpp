@@ -46,12 +46,27 @@ Python Comparison:
 */
 
 #include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include "linked_queue_baseline.h"   // Benchmark baseline (task 2 linked queue)
 using namespace std;
 
 //==============================================================================
 // CIRCULAR QUEUE STRUCTURE
 //==============================================================================
 
+/*
+WHAT HAPPENS WHEN THE QUEUE IS FULL?
+REJECT_WHEN_FULL - enqueue() refuses the element (classic circular queue)
+GROW_WHEN_FULL   - enqueue() doubles the array first (see growQueue), so
+                   the queue is unbounded like the linked-list queue of
+                   task 2 but without one `new` per element
+*/
+enum FullPolicy { REJECT_WHEN_FULL, GROW_WHEN_FULL };
+
 template <typename T>
 struct CircularQueue {
     T* arr;          // Pointer to array (static memory)
@@ -59,6 +74,7 @@ struct CircularQueue {
     int rear;        // Index of rear element
     int capacity;    // Maximum capacity
     int count;       // Current number of elements
+    FullPolicy policy;  // Reject or grow when full
     
     /*
     WHY BOTH rear AND count?
@@ -86,12 +102,14 @@ Time Complexity: O(1)
 Space Complexity: O(capacity)
 */
 template <typename T>
-void initCircularQueue(CircularQueue<T>* queue, int capacity) {
+void initCircularQueue(CircularQueue<T>* queue, int capacity,
+                       FullPolicy policy = REJECT_WHEN_FULL) {
     queue->arr = new T[capacity];  // Allocate array
     queue->capacity = capacity;
     queue->front = 0;
     queue->rear = -1;   // -1 indicates empty queue
     queue->count = 0;
+    queue->policy = policy;
     
     /*
     MEMORY LAYOUT:
@@ -143,6 +161,46 @@ int size(CircularQueue<T>* queue) {
     return queue->count;
 }
 
+//==============================================================================
+// GROWTH (GROW_WHEN_FULL POLICY)
+//==============================================================================
+
+/*
+GROW QUEUE - double the capacity, keeping FIFO order
+-----------------------------------------------------
+The elements of a full queue may wrap around the end of the array. The
+new array gets them "unwrapped" (front at index 0) in at most TWO moves:
+
+    Old (capacity 5, full):   [60][70][30][40][50]
+                                    ^rear ^front
+    Move 1: arr[front..end]  -> new[0..2]      30 40 50
+    Move 2: arr[0..rear]     -> new[3..4]      60 70
+
+    New (capacity 10):        [30][40][50][60][70][  ][  ][  ][  ][  ]
+                               ^front          ^rear
+
+Time Complexity: O(n) for this call, but AMORTIZED O(1) per enqueue:
+growing to 2n costs n moves and is followed by n cheap enqueues before
+the next growth, so each element is moved at most ~2 times on average.
+No per-element allocation: one new[] per doubling.
+*/
+template <typename T>
+void growQueue(CircularQueue<T>* queue) {
+    int newCapacity = queue->capacity > 0 ? queue->capacity * 2 : 1;
+    T* newArr = new T[newCapacity];
+
+    int first = queue->capacity - queue->front;   // front .. end of array
+    if (first > queue->count) first = queue->count;
+    move(queue->arr + queue->front, queue->arr + queue->front + first, newArr);
+    move(queue->arr, queue->arr + (queue->count - first), newArr + first);  // Wrapped part
+
+    delete[] queue->arr;
+    queue->arr = newArr;
+    queue->capacity = newCapacity;
+    queue->front = 0;
+    queue->rear = queue->count - 1;
+}
+
 //==============================================================================
 // ENQUEUE OPERATION
 //==============================================================================
@@ -168,10 +226,14 @@ CIRCULAR WRAP EXPLAINED:
 */
 template <typename T>
 void enqueue(CircularQueue<T>* queue, T value) {
-    // Step 1: Check overflow
+    // Step 1: Check overflow (grow instead if the policy allows it)
     if (isFull(queue)) {
-        cout << "Error: Queue Overflow - Queue is full!" << endl;
-        return;
+        if (queue->policy == GROW_WHEN_FULL) {
+            growQueue(queue);
+        } else {
+            cout << "Error: Queue Overflow - Queue is full!" << endl;
+            return;
+        }
     }
     
     // Step 2: Calculate new rear position (circular)
@@ -201,7 +263,7 @@ void enqueue(CircularQueue<T>* queue, T value) {
     */
     
     // Step 3: Insert element
-    queue->arr[queue->rear] = value;
+    queue->arr[queue->rear] = move(value);
     
     // Step 4: Increment count
     queue->count++;
@@ -425,16 +487,100 @@ void demonstrateCircularQueue() {
     enqueue(&strQueue, string("Circular"));
     display(&strQueue);
     
+    // Growable queue
+    cout << "\n9. Growable queue (GROW_WHEN_FULL, capacity=4):\n";
+    CircularQueue<int> growing;
+    initCircularQueue(&growing, 4, GROW_WHEN_FULL);
+    for (int i = 1; i <= 4; i++)
+        enqueue(&growing, i * 10);
+    dequeue(&growing);
+    dequeue(&growing);
+    enqueue(&growing, 50);
+    enqueue(&growing, 60);          // Full now, and wrapped around
+    display(&growing);
+    
+    cout << "   Enqueue 70 -> capacity doubles and contents unwrap:\n";
+    enqueue(&growing, 70);
+    display(&growing);
+    cout << "   Capacity: " << growing.capacity << endl;
+    
     // Cleanup
     destroyCircularQueue(&queue);
     destroyCircularQueue(&strQueue);
+    destroyCircularQueue(&growing);
+}
+
+//==============================================================================
+// BENCHMARK: GROWABLE RING vs LINKED QUEUE (task2_linked_queue.cpp)
+//==============================================================================
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+Two workloads, 10M operations each:
+  - fill then drain: 5M enqueues followed by 5M dequeues (the ring grows
+    from capacity 16 up to 8M along the way)
+  - steady mix: enqueue 3 / dequeue 2 repeated, so the queue slowly grows
+    while elements are constantly leaving the front
+*/
+template <typename Q>
+long long fillThenDrain(Q* queue, int ops) {
+    long long sum = 0;
+    for (int i = 0; i < ops / 2; i++)
+        enqueue(queue, i);
+    for (int i = 0; i < ops / 2; i++)
+        sum += dequeue(queue);
+    return sum;
+}
+
+template <typename Q>
+long long steadyMix(Q* queue, int ops) {
+    long long sum = 0;
+    for (int i = 0; i < ops / 5; i++) {
+        enqueue(queue, 3 * i);
+        enqueue(queue, 3 * i + 1);
+        enqueue(queue, 3 * i + 2);
+        sum += dequeue(queue);
+        sum += dequeue(queue);
+    }
+    return sum;
+}
+
+void benchmark() {
+    const int ops = 10000000;
+    cout << "\n" << ops << " operations per workload (M ops/sec)\n\n";
+    cout << "Workload          | Linked Queue | Growable ring\n";
+    cout << "------------------|--------------|--------------\n";
+
+    for (int workload = 0; workload < 2; workload++) {
+        LinkedQueue<int> linked;
+        initQueue(&linked);
+        auto start = chrono::steady_clock::now();
+        long long linkedSum = workload == 0 ? fillThenDrain(&linked, ops) : steadyMix(&linked, ops);
+        double linkedTime = secondsSince(start);
+        destroyQueue(&linked);
+
+        CircularQueue<int> ring;
+        initCircularQueue(&ring, 16, GROW_WHEN_FULL);
+        start = chrono::steady_clock::now();
+        long long ringSum = workload == 0 ? fillThenDrain(&ring, ops) : steadyMix(&ring, ops);
+        double ringTime = secondsSince(start);
+        destroyCircularQueue(&ring);
+
+        if (linkedSum != ringSum)
+            cout << "Error: queues returned different elements" << endl;
+        printf("%-17s | %12.1f | %13.1f\n", workload == 0 ? "Fill then drain" : "Steady mix 3:2",
+               ops / linkedTime / 1e6, ops / ringTime / 1e6);
+    }
 }
 
 //==============================================================================
 // MAIN FUNCTION
 //==============================================================================
 
-int main() {
+int main(int argc, char* argv[]) {
     cout << "========================================================\n";
     cout << "  TASK 1: CIRCULAR QUEUE USING STATIC MEMORY (ARRAY)\n";
     cout << "========================================================\n";
@@ -445,6 +591,9 @@ int main() {
     cout << "  Demonstration completed successfully!\n";
     cout << "========================================================\n\n";
     
+    // ./task1 bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
     return 0;
 }
 
@@ -469,7 +618,8 @@ KEY CONCEPTS SUMMARY
    - Fixed memory allocation (no dynamic resizing)
 
 4. DISADVANTAGES:
-   - Fixed capacity (can't grow)
+   - Fixed capacity (unless created with GROW_WHEN_FULL, which doubles
+     the array when full: amortized O(1) enqueue)
    - Must check for overflow/underflow
    - Slightly more complex than simple array queue
 
@@ -490,5 +640,6 @@ KEY CONCEPTS SUMMARY
 COMPILATION AND EXECUTION:
    g++ -std=c++11 task1_circular_queue.cpp -o task1
    ./task1
+   ./task1 bench      (growable ring vs linked queue)
 ================================================================================
 */
@@ -0,0 +1,446 @@
+/*
+================================================================================
+TASK 2 (VARIANT): CHUNKED LINKED QUEUE
+================================================================================
+
+WHAT IS WRONG WITH ONE NODE PER ELEMENT?
+----------------------------------------
+task2_linked_queue.cpp calls `new QueueNode` in every enqueue and `delete`
+in every dequeue. For a Queue<int>:
+    - each 4-byte int costs a 16-byte node plus allocator overhead
+      (usually 32 bytes per allocation in total)
+    - every operation is a trip into the allocator
+    - consecutive elements are scattered around the heap
+
+CHUNKED (UNROLLED) QUEUE
+------------------------
+Store many elements per node. Each BLOCK holds BLOCK_SIZE elements:
+
+    frontBlock                                  rearBlock
+        |                                           |
+        v                                           v
+    [ _  _  30 40 ... 99 |•]--> [100 ... 355 |•]--> [356 357 _ _ ... _ |NULL]
+            ^frontIndex                                      ^rearIndex
+                                                              (next free slot)
+
+    enqueue: write data[rearIndex++]; only when the rear block is full
+             do we link a new block behind it
+    dequeue: read data[frontIndex++]; only when the front block is used up
+             do we unlink it
+
+So there is one allocation per BLOCK_SIZE elements instead of one per
+element, and the elements of a block sit next to each other in memory.
+
+BLOCK RECYCLING
+---------------
+A used-up front block is not deleted straight away: it goes onto a small
+free list, and the next time the rear needs a new block it is taken from
+there. A queue that stays around the same size therefore stops allocating
+altogether. The free list is capped (MAX_FREE_BLOCKS) so memory from a
+one-off burst is still returned.
+
+Same API as task2_linked_queue.cpp: initQueue, enqueue, dequeue, getFront,
+getRear, isEmpty, getSize, display, destroyQueue.
+*/
+
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#define HAVE_FORK_RUSAGE 1
+#endif
+#include "linked_queue_baseline.h"   // Benchmark baseline (task 2 linked queue)
+using namespace std;
+
+//==============================================================================
+// BLOCK AND QUEUE STRUCTURES
+//==============================================================================
+
+const int BLOCK_SIZE = 256;       // Elements per block
+const int MAX_FREE_BLOCKS = 4;    // Spare blocks kept for reuse
+
+/*
+QUEUE BLOCK
+-----------
+For Queue<int>: 256 * 4 bytes + 8-byte pointer = ~1 KB per block,
+so a million ints need ~4000 allocations instead of a million.
+*/
+template <typename T>
+struct QueueBlock {
+    T data[BLOCK_SIZE];
+    QueueBlock<T>* next;
+};
+
+template <typename T>
+struct Queue {
+    QueueBlock<T>* frontBlock;  // Block holding the front element
+    QueueBlock<T>* rearBlock;   // Block receiving new elements
+    int frontIndex;             // Index of the front element in frontBlock
+    int rearIndex;              // Next free index in rearBlock
+    int size;                   // Number of elements in queue
+
+    QueueBlock<T>* freeList;    // Recycled blocks, linked through next
+    int freeCount;
+};
+
+//==============================================================================
+// BLOCK ALLOCATION
+//==============================================================================
+
+template <typename T>
+QueueBlock<T>* allocBlock(Queue<T>* queue) {
+    QueueBlock<T>* block = queue->freeList;
+    if (block != nullptr) {
+        queue->freeList = block->next;
+        queue->freeCount--;
+    } else {
+        block = new QueueBlock<T>;
+    }
+    block->next = nullptr;
+    return block;
+}
+
+template <typename T>
+void releaseBlock(Queue<T>* queue, QueueBlock<T>* block) {
+    if (queue->freeCount < MAX_FREE_BLOCKS) {
+        block->next = queue->freeList;
+        queue->freeList = block;
+        queue->freeCount++;
+    } else {
+        delete block;
+    }
+}
+
+//==============================================================================
+// INITIALIZATION
+//==============================================================================
+
+/*
+An empty queue still owns one block, so enqueue never has to special-case
+"no blocks yet"; it is allocated here, not per element.
+*/
+template <typename T>
+void initQueue(Queue<T>* queue) {
+    queue->freeList = nullptr;
+    queue->freeCount = 0;
+    queue->frontBlock = allocBlock(queue);
+    queue->rearBlock = queue->frontBlock;
+    queue->frontIndex = 0;
+    queue->rearIndex = 0;
+    queue->size = 0;
+}
+
+//==============================================================================
+// HELPER FUNCTIONS
+//==============================================================================
+
+template <typename T>
+bool isEmpty(Queue<T>* queue) {
+    return queue->size == 0;
+}
+
+template <typename T>
+int getSize(Queue<T>* queue) {
+    return queue->size;
+}
+
+//==============================================================================
+// ENQUEUE / DEQUEUE
+//==============================================================================
+
+/*
+ENQUEUE - Add element to rear
+Time Complexity: O(1); allocates (or recycles) a block only once every
+BLOCK_SIZE enqueues.
+*/
+template <typename T>
+void enqueue(Queue<T>* queue, T value) {
+    if (queue->rearIndex == BLOCK_SIZE) {
+        // Rear block is full: link a fresh one behind it
+        QueueBlock<T>* block = allocBlock(queue);
+        queue->rearBlock->next = block;
+        queue->rearBlock = block;
+        queue->rearIndex = 0;
+    }
+    queue->rearBlock->data[queue->rearIndex++] = move(value);
+    queue->size++;
+}
+
+/*
+DEQUEUE - Remove and return front element
+Time Complexity: O(1); a used-up front block goes to the free list.
+*/
+template <typename T>
+T dequeue(Queue<T>* queue) {
+    if (isEmpty(queue)) {
+        cout << "Error: Queue Underflow - Cannot dequeue from empty queue!" << endl;
+        exit(1);
+    }
+
+    T value = move(queue->frontBlock->data[queue->frontIndex++]);
+    queue->size--;
+
+    if (queue->size == 0) {
+        // Empty again: rewind to the start of the current block
+        // (front and rear are in the same block now)
+        queue->frontIndex = 0;
+        queue->rearIndex = 0;
+    } else if (queue->frontIndex == BLOCK_SIZE) {
+        // Front block used up: move to the next block and recycle this one
+        QueueBlock<T>* used = queue->frontBlock;
+        queue->frontBlock = used->next;
+        queue->frontIndex = 0;
+        releaseBlock(queue, used);
+    }
+    return value;
+}
+
+//==============================================================================
+// PEEK OPERATIONS
+//==============================================================================
+
+template <typename T>
+T getFront(Queue<T>* queue) {
+    if (isEmpty(queue)) {
+        cout << "Error: Queue is empty!" << endl;
+        exit(1);
+    }
+    return queue->frontBlock->data[queue->frontIndex];
+}
+
+template <typename T>
+T getRear(Queue<T>* queue) {
+    if (isEmpty(queue)) {
+        cout << "Error: Queue is empty!" << endl;
+        exit(1);
+    }
+    return queue->rearBlock->data[queue->rearIndex - 1];
+}
+
+//==============================================================================
+// DISPLAY FUNCTION
+//==============================================================================
+
+template <typename T>
+void display(Queue<T>* queue) {
+    if (isEmpty(queue)) {
+        cout << "Queue is empty" << endl;
+        return;
+    }
+
+    cout << "Queue (front to rear): ";
+    int blocks = 0;
+    for (QueueBlock<T>* block = queue->frontBlock; block != nullptr; block = block->next) {
+        int start = block == queue->frontBlock ? queue->frontIndex : 0;
+        int end = block == queue->rearBlock ? queue->rearIndex : BLOCK_SIZE;
+        for (int i = start; i < end; i++)
+            cout << block->data[i] << " ";
+        blocks++;
+    }
+    cout << endl;
+    cout << "  [size=" << queue->size << ", blocks=" << blocks
+         << ", spare blocks=" << queue->freeCount << "]" << endl;
+}
+
+//==============================================================================
+// CLEANUP
+//==============================================================================
+
+/*
+DESTROY QUEUE - Free every block (in use and spare)
+Time Complexity: O(n / BLOCK_SIZE) deletes
+*/
+template <typename T>
+void destroyQueue(Queue<T>* queue) {
+    QueueBlock<T>* block = queue->frontBlock;
+    while (block != nullptr) {
+        QueueBlock<T>* next = block->next;
+        delete block;
+        block = next;
+    }
+    while (queue->freeList != nullptr) {
+        QueueBlock<T>* next = queue->freeList->next;
+        delete queue->freeList;
+        queue->freeList = next;
+    }
+    queue->frontBlock = nullptr;
+    queue->rearBlock = nullptr;
+    queue->size = 0;
+    queue->freeCount = 0;
+}
+
+//==============================================================================
+// DEMONSTRATION
+//==============================================================================
+
+void demonstrateChunkedQueue() {
+    cout << "\n====================================================\n";
+    cout << "  CHUNKED QUEUE DEMONSTRATION (block size " << BLOCK_SIZE << ")\n";
+    cout << "====================================================\n\n";
+
+    Queue<int> queue;
+    initQueue(&queue);
+
+    cout << "1. Enqueuing: 10, 20, 30, 40, 50\n";
+    for (int v = 10; v <= 50; v += 10)
+        enqueue(&queue, v);
+    display(&queue);
+
+    cout << "\n2. Front: " << getFront(&queue) << ", Rear: " << getRear(&queue)
+         << ", Size: " << getSize(&queue) << endl;
+
+    int first = dequeue(&queue);
+    int second = dequeue(&queue);
+    cout << "\n3. Dequeued: " << first << ", " << second << endl;
+    while (!isEmpty(&queue))
+        dequeue(&queue);
+
+    // Cross several block boundaries
+    cout << "\n4. Enqueue 1000 values, then dequeue 600:\n";
+    for (int i = 0; i < 1000; i++)
+        enqueue(&queue, i);
+    long long sum = 0;
+    for (int i = 0; i < 600; i++)
+        sum += dequeue(&queue);
+    cout << "   Sum of dequeued = " << sum << " (expected " << 599 * 600 / 2 << ")\n";
+    cout << "   Front: " << getFront(&queue) << ", Rear: " << getRear(&queue)
+         << ", Size: " << getSize(&queue) << ", spare blocks: " << queue.freeCount << endl;
+
+    cout << "\n5. Testing with strings:\n";
+    Queue<string> strQueue;
+    initQueue(&strQueue);
+    enqueue(&strQueue, string("First"));
+    enqueue(&strQueue, string("Second"));
+    enqueue(&strQueue, string("Third"));
+    dequeue(&strQueue);
+    display(&strQueue);
+
+    destroyQueue(&queue);
+    destroyQueue(&strQueue);
+}
+
+//==============================================================================
+// BENCHMARK: CHUNKED vs NODE-PER-ELEMENT (task2_linked_queue.cpp)
+//==============================================================================
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+Workloads (ops = enqueues + dequeues):
+  0 - fill then drain: ops/2 enqueues, then ops/2 dequeues (peak size ops/2)
+  1 - steady: queue held at 1000 elements, one enqueue + one dequeue per step
+*/
+template <typename Q>
+double runWorkload(int workload, int ops) {
+    Q queue;
+    initQueue(&queue);
+    long long sum = 0;
+
+    auto start = chrono::steady_clock::now();
+    if (workload == 0) {
+        for (int i = 0; i < ops / 2; i++)
+            enqueue(&queue, i);
+        for (int i = 0; i < ops / 2; i++)
+            sum += dequeue(&queue);
+    } else {
+        for (int i = 0; i < 1000; i++)
+            enqueue(&queue, i);
+        for (int i = 0; i < ops / 2; i++) {
+            enqueue(&queue, i);
+            sum += dequeue(&queue);
+        }
+    }
+    double elapsed = secondsSince(start);
+
+    destroyQueue(&queue);
+    if (sum < 0)
+        cout << "Error: bad checksum" << endl;
+    return ops / elapsed;
+}
+
+/*
+Each run happens in a fresh child process, so its peak resident memory
+(ru_maxrss from wait4) belongs to that queue alone and is not hidden by
+memory the other queue already touched. Without fork/wait4 (e.g. Windows)
+the run stays in this process and only the rate is reported.
+*/
+template <typename Q>
+void measureInChild(const char* name, int workload, int ops) {
+#ifdef HAVE_FORK_RUSAGE
+    int fds[2];
+    if (pipe(fds) != 0) {
+        cout << "Error: pipe failed" << endl;
+        return;
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        double rate = runWorkload<Q>(workload, ops);
+        if (write(fds[1], &rate, sizeof(rate)) != sizeof(rate))
+            _exit(1);
+        _exit(0);
+    }
+    close(fds[1]);
+    double rate = 0;
+    if (read(fds[0], &rate, sizeof(rate)) != sizeof(rate))
+        cout << "Error: child did not report a result" << endl;
+    close(fds[0]);
+
+    int status;
+    struct rusage usage;
+    wait4(pid, &status, 0, &usage);
+    printf("%-22s | %13.1f | %12.1f\n", name, rate / 1e6, usage.ru_maxrss / 1024.0);
+#else
+    printf("%-22s | %13.1f | %12s\n", name, runWorkload<Q>(workload, ops) / 1e6, "-");
+#endif
+}
+
+void benchmark() {
+    const int ops = 20000000;
+    cout << "\n" << ops << " operations, Queue<int>, block size " << BLOCK_SIZE << "\n";
+
+    const char* workloads[] = {"Fill then drain", "Steady (1000 queued)"};
+    for (int w = 0; w < 2; w++) {
+        cout << "\n" << workloads[w] << ":\n";
+        cout << "Queue                  | M ops/sec     | Peak RSS MB\n";
+        cout << "-----------------------|---------------|------------\n";
+        measureInChild<LinkedQueue<int> >("Node per element", w, ops);
+        measureInChild<Queue<int> >("Chunked + free list", w, ops);
+    }
+}
+
+//==============================================================================
+// MAIN FUNCTION
+//==============================================================================
+
+int main(int argc, char* argv[]) {
+    cout << "========================================================\n";
+    cout << "  TASK 2 (VARIANT): CHUNKED LINKED QUEUE\n";
+    cout << "========================================================\n";
+
+    demonstrateChunkedQueue();
+
+    // ./task2_chunked bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
+    return 0;
+}
+
+/*
+================================================================================
+COMPILATION AND EXECUTION:
+   g++ -std=c++11 -O2 task2_chunked_queue.cpp -o task2_chunked
+   ./task2_chunked
+   ./task2_chunked bench     (ops/sec and peak RSS vs node-per-element)
+   (peak RSS needs fork/wait4, i.e. Linux or macOS; elsewhere only ops/sec)
+================================================================================
+*/
@@ -0,0 +1,479 @@
+/*
+================================================================================
+TASK 3 (EXTENSION): STREAMING INFIX EXPRESSION EVALUATOR
+================================================================================
+
+demonstrateApplication() in task3_templates.cpp evaluates ONE hard-coded
+postfix expression. This program evaluates a whole FILE of ordinary infix
+expressions, one per line:
+
+    (3 + 4) * 12 - 7 / (2 + 1)
+    18 / (4 - 2 * 2)              <- division by zero: reported as invalid
+    5 * (2 + 8
+    99999999999 * 99999999999     <- overflows long long: reported as invalid
+
+Each line goes through two classic stack algorithms:
+
+1. SHUNTING-YARD (Dijkstra): infix -> postfix
+   ------------------------------------------
+   Numbers go straight to the output. Operators wait on an operator stack
+   until an operator of lower precedence (or a ')') arrives:
+
+       Input:  (3 + 4) * 12
+       Token   Action                    Operator stack   Output
+       (       push                      (
+       3       output                    (                3
+       +       push                      ( +              3
+       4       output                    ( +              3 4
+       )       pop until (               (empty)          3 4 +
+       *       push                      *                3 4 +
+       12      output                    *                3 4 + 12
+       end     pop everything                             3 4 + 12 *
+
+2. RPN EVALUATION: postfix -> value
+   --------------------------------
+   Numbers are pushed; an operator pops two values and pushes the result
+   (exactly what demonstrateApplication() does step by step).
+
+PERFORMANCE
+-----------
+- Input is read with fread() in 4 MB chunks, never line by line; a line
+  cut in half at the end of a chunk is moved to the front of the buffer
+  and completed by the next read.
+- The operator stack, the postfix token list and the value stack are
+  ReservedStacks (Week 4/staticStack.h): arrays reserved once, then
+  cleared (top = 0) and reused for every expression, so there is no
+  new/delete per token or per line.
+
+Usage:
+    ./stream_eval                       demo on a few built-in expressions
+    ./stream_eval file.txt              evaluate a file ( - = stdin )
+    ./stream_eval gen file.txt 2048     write ~2048 MB of random expressions
+    ./stream_eval bench [MB]            generate a temp file (default 512 MB)
+                                        and evaluate it
+*/
+
+#include <iostream>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include "../../Week 4/staticStack.h"   // ReservedStack
+using namespace std;
+
+//==============================================================================
+// SHUNTING-YARD: INFIX -> POSTFIX
+//==============================================================================
+
+// A postfix token: a number (op == 0) or an operator character
+struct Token {
+    char op;
+    long long value;
+};
+
+int precedence(char op) {
+    return (op == '*' || op == '/') ? 2 : 1;   // + and - are 1
+}
+
+/*
+Converts the infix text [p, end) to postfix tokens in *output.
+Operators are left-associative: an operator pops every waiting operator
+of the SAME or higher precedence (so 8 - 3 - 2 means (8 - 3) - 2).
+Returns false for malformed input: unknown characters, unbalanced
+parentheses, or two operands / two operators in a row.
+*/
+bool infixToPostfix(const char* p, const char* end,
+                    ReservedStack<char>* operators, ReservedStack<Token>* output) {
+    clearStack(operators);
+    clearStack(output);
+    bool expectOperand = true;      // Next token must be a number or '('
+
+    while (p < end) {
+        char c = *p;
+        if (c == ' ' || c == '\t' || c == '\r') {
+            p++;
+        } else if (c >= '0' && c <= '9') {
+            if (!expectOperand) return false;
+            long long value = 0;
+            while (p < end && *p >= '0' && *p <= '9') {
+                int digit = *p++ - '0';
+                if (value > (LLONG_MAX - digit) / 10)
+                    return false;                       // Literal too big
+                value = value * 10 + digit;
+            }
+            Token t = {0, value};
+            push(output, t);
+            expectOperand = false;
+        } else if (c == '(') {
+            if (!expectOperand) return false;
+            push(operators, c);
+            p++;
+        } else if (c == ')') {
+            if (expectOperand) return false;
+            while (!isEmpty(operators) && top_unchecked(operators) != '(') {
+                Token t = {pop_unchecked(operators), 0};
+                push(output, t);
+            }
+            if (isEmpty(operators)) return false;      // No matching '('
+            pop_unchecked(operators);                             // Discard the '('
+            p++;
+        } else if (c == '+' || c == '-' || c == '*' || c == '/') {
+            if (expectOperand) return false;
+            while (!isEmpty(operators) && top_unchecked(operators) != '(' &&
+                   precedence(top_unchecked(operators)) >= precedence(c)) {
+                Token t = {pop_unchecked(operators), 0};
+                push(output, t);
+            }
+            push(operators, c);
+            expectOperand = true;
+            p++;
+        } else {
+            return false;
+        }
+    }
+    if (expectOperand) return false;                    // Empty line or trailing operator
+
+    while (!isEmpty(operators)) {
+        char op = pop_unchecked(operators);
+        if (op == '(') return false;                    // Unclosed '('
+        Token t = {op, 0};
+        push(output, t);
+    }
+    return true;
+}
+
+//==============================================================================
+// RPN EVALUATION: POSTFIX -> VALUE
+//==============================================================================
+
+/*
+Checked long long arithmetic: false if the exact result does not fit (the
+input is untrusted, and signed overflow is undefined behaviour).
+*/
+bool checkedAdd(long long a, long long b, long long* result) {
+    if ((b > 0 && a > LLONG_MAX - b) || (b < 0 && a < LLONG_MIN - b))
+        return false;
+    *result = a + b;
+    return true;
+}
+
+bool checkedSub(long long a, long long b, long long* result) {
+    if ((b < 0 && a > LLONG_MAX + b) || (b > 0 && a < LLONG_MIN + b))
+        return false;
+    *result = a - b;
+    return true;
+}
+
+bool checkedMul(long long a, long long b, long long* result) {
+    if (a != 0 && b != 0) {
+        bool overflow;
+        if (a > 0) overflow = b > 0 ? a > LLONG_MAX / b : b < LLONG_MIN / a;
+        else       overflow = b > 0 ? a < LLONG_MIN / b : a < LLONG_MAX / b;
+        if (overflow)
+            return false;
+    }
+    *result = a * b;
+    return true;
+}
+
+// Division by zero and LLONG_MIN / -1 (the one quotient that overflows)
+bool checkedDiv(long long a, long long b, long long* result) {
+    if (b == 0 || (a == LLONG_MIN && b == -1))
+        return false;
+    *result = a / b;
+    return true;
+}
+
+/*
+infixToPostfix() already guarantees every operator has two operands, so
+the only runtime errors left are division by zero and overflow.
+*/
+bool evaluatePostfix(ReservedStack<Token>* postfix, ReservedStack<long long>* values,
+                     long long* result) {
+    clearStack(values);
+    for (int i = 0; i < postfix->top; i++) {
+        Token t = postfix->items[i];
+        if (t.op == 0) {
+            push(values, t.value);
+            continue;
+        }
+        long long b = pop_unchecked(values);
+        long long a = pop_unchecked(values);
+        long long r;
+        bool ok;
+        switch (t.op) {
+            case '+': ok = checkedAdd(a, b, &r); break;
+            case '-': ok = checkedSub(a, b, &r); break;
+            case '*': ok = checkedMul(a, b, &r); break;
+            default:  ok = checkedDiv(a, b, &r);
+        }
+        if (!ok) return false;
+        push(values, r);
+    }
+    *result = pop_unchecked(values);
+    return true;
+}
+
+//==============================================================================
+// STREAMING DRIVER
+//==============================================================================
+
+struct Evaluator {
+    ReservedStack<char> operators;
+    ReservedStack<Token> postfix;
+    ReservedStack<long long> values;
+
+    long long expressions;   // Lines evaluated (blank lines are skipped)
+    long long invalid;       // Lines that were malformed, divided by zero or overflowed
+    long long checksum;      // Sum of all results (wrapping), to verify runs agree
+    long long bytes;
+};
+
+void initEvaluator(Evaluator* ev) {
+    reserveStack(&ev->operators, 256);
+    reserveStack(&ev->postfix, 1024);
+    reserveStack(&ev->values, 256);
+    ev->expressions = ev->invalid = ev->checksum = ev->bytes = 0;
+}
+
+void destroyEvaluator(Evaluator* ev) {
+    destroyStack(&ev->operators);
+    destroyStack(&ev->postfix);
+    destroyStack(&ev->values);
+}
+
+// Evaluates one line [p, end); returns false if it is invalid
+bool evaluateLine(Evaluator* ev, const char* p, const char* end, long long* result) {
+    return infixToPostfix(p, end, &ev->operators, &ev->postfix) &&
+           evaluatePostfix(&ev->postfix, &ev->values, result);
+}
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+void processLine(Evaluator* ev, const char* p, const char* end) {
+    while (p < end && isBlank(*p)) p++;
+    while (end > p && isBlank(end[-1])) end--;
+    if (p == end) return;   // Blank line (also "\r" from CRLF files)
+    long long result;
+    ev->expressions++;
+    if (evaluateLine(ev, p, end, &result))
+        ev->checksum = (long long)((unsigned long long)ev->checksum + (unsigned long long)result);
+    else
+        ev->invalid++;
+}
+
+/*
+Reads the whole stream in CHUNK-sized blocks:
+
+    buffer: [ line | line | line | line | half a li ]
+                                        ^ last '\n'
+    process every complete line, move "half a li" to the front,
+    fill the rest of the buffer with the next fread().
+
+A line longer than the buffer makes the buffer grow (once).
+*/
+const size_t CHUNK = 4 << 20;
+
+void evaluateStream(Evaluator* ev, FILE* in) {
+    size_t capacity = CHUNK;
+    char* buffer = new char[capacity];
+    size_t carried = 0;      // Bytes of an unfinished line at the front
+
+    while (true) {
+        size_t got = fread(buffer + carried, 1, capacity - carried, in);
+        ev->bytes += got;
+        size_t filled = carried + got;
+        if (got == 0) {
+            processLine(ev, buffer, buffer + filled);   // Last line without '\n'
+            break;
+        }
+
+        const char* lineStart = buffer;
+        const char* bufEnd = buffer + filled;
+        while (true) {
+            const char* newline = (const char*)memchr(lineStart, '\n', bufEnd - lineStart);
+            if (newline == nullptr) break;
+            processLine(ev, lineStart, newline);
+            lineStart = newline + 1;
+        }
+
+        carried = bufEnd - lineStart;
+        if (carried == capacity) {
+            // One line fills the whole buffer: double it
+            char* bigger = new char[capacity * 2];
+            memcpy(bigger, buffer, carried);
+            delete[] buffer;
+            buffer = bigger;
+            capacity *= 2;
+        } else {
+            memmove(buffer, lineStart, carried);
+        }
+    }
+    delete[] buffer;
+}
+
+//==============================================================================
+// INPUT GENERATOR
+//==============================================================================
+
+uint64_t nextRandom(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+/*
+Writes random expressions with 2-8 operands (1-99) and some parenthesised
+groups. 1 in 50 lines gets a trailing operator (a syntax error), and random
+'/' sometimes divides by a group that is 0, so about 3% of all lines are
+invalid. Operands stay small enough that results fit comfortably in a
+long long.
+*/
+void generateFile(const char* path, long long megabytes) {
+    FILE* out = fopen(path, "wb");
+    if (out == nullptr) {
+        cout << "Error: cannot write " << path << endl;
+        return;
+    }
+    const char ops[] = "+-*/";
+    uint64_t state = 0x5DEECE66Dull;
+    long long target = megabytes << 20, written = 0;
+    char line[256];
+
+    while (written < target) {
+        int len = 0, operands = 2 + nextRandom(&state) % 7, open = 0;
+        for (int i = 0; i < operands; i++) {
+            if (i + 1 < operands && nextRandom(&state) % 4 == 0) {
+                line[len++] = '(';
+                open++;
+            }
+            len += sprintf(line + len, "%d", (int)(nextRandom(&state) % 99) + 1);
+            if (open > 0 && nextRandom(&state) % 3 == 0) {
+                line[len++] = ')';
+                open--;
+            }
+            if (i + 1 < operands)
+                len += sprintf(line + len, " %c ", ops[nextRandom(&state) % 4]);
+        }
+        while (open-- > 0)
+            line[len++] = ')';
+        if (nextRandom(&state) % 50 == 0)
+            line[len++] = '+';                  // Trailing operator: invalid
+        line[len++] = '\n';
+        written += fwrite(line, 1, len, out);
+    }
+    fclose(out);
+}
+
+//==============================================================================
+// DEMONSTRATION AND BENCHMARK
+//==============================================================================
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+void demonstrate() {
+    cout << "\n====================================================\n";
+    cout << "  INFIX -> POSTFIX -> VALUE\n";
+    cout << "====================================================\n\n";
+
+    const char* lines[] = {
+        "(3 + 4) * 12 - 7 / (2 + 1)",
+        "8 - 3 - 2",
+        "2 * (3 + 4) * 5",
+        "18 / (4 - 2 * 2)",
+        "5 * (2 + 8",
+        "1 + + 2",
+        "99999999999 * 99999999999",
+    };
+    Evaluator ev;
+    initEvaluator(&ev);
+
+    for (const char* text : lines) {
+        const char* end = text + strlen(text);
+        printf("  %-28s", text);
+        long long result;
+        if (!infixToPostfix(text, end, &ev.operators, &ev.postfix)) {
+            printf("invalid (syntax)\n");
+            continue;
+        }
+        printf("postfix:");
+        for (int i = 0; i < ev.postfix.top; i++) {
+            if (ev.postfix.items[i].op == 0) printf(" %lld", ev.postfix.items[i].value);
+            else printf(" %c", ev.postfix.items[i].op);
+        }
+        if (evaluatePostfix(&ev.postfix, &ev.values, &result))
+            printf("  = %lld\n", result);
+        else
+            printf("  invalid (division by zero or overflow)\n");
+    }
+    destroyEvaluator(&ev);
+}
+
+void report(Evaluator* ev, double seconds) {
+    printf("%lld expressions (%lld invalid), %.1f MB in %.2f s\n",
+           ev->expressions, ev->invalid, ev->bytes / 1048576.0, seconds);
+    printf("%.2f M expressions/sec, %.0f MB/sec, checksum %lld\n",
+           ev->expressions / seconds / 1e6, ev->bytes / 1048576.0 / seconds, ev->checksum);
+}
+
+void evaluateFile(const char* path) {
+    FILE* in = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    if (in == nullptr) {
+        cout << "Error: cannot open " << path << endl;
+        return;
+    }
+    Evaluator ev;
+    initEvaluator(&ev);
+    auto start = chrono::steady_clock::now();
+    evaluateStream(&ev, in);
+    report(&ev, secondsSince(start));
+    destroyEvaluator(&ev);
+    if (in != stdin)
+        fclose(in);
+}
+
+void benchmark(long long megabytes) {
+    const char* path = "/tmp/stream_eval_bench.txt";
+    cout << "\nGenerating " << megabytes << " MB of expressions in " << path << "...\n";
+    auto start = chrono::steady_clock::now();
+    generateFile(path, megabytes);
+    cout << "  (" << secondsSince(start) << " s)\n\nEvaluating:\n";
+    evaluateFile(path);
+    remove(path);
+}
+
+//==============================================================================
+// MAIN FUNCTION
+//==============================================================================
+
+int main(int argc, char* argv[]) {
+    if (argc >= 4 && strcmp(argv[1], "gen") == 0) {
+        generateFile(argv[2], atoll(argv[3]));
+    } else if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+        benchmark(argc >= 3 ? atoll(argv[2]) : 512);
+    } else if (argc >= 2) {
+        evaluateFile(argv[1]);
+    } else {
+        demonstrate();
+    }
+    return 0;
+}
+
+/*
+================================================================================
+COMPILATION AND EXECUTION:
+   g++ -std=c++14 -O2 task3_stream_evaluator.cpp -o stream_eval
+   ./stream_eval
+   ./stream_eval gen exprs.txt 4096 && ./stream_eval exprs.txt
+   ./stream_eval bench 1024
+================================================================================
+*/
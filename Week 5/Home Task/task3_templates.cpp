@@ -47,6 +47,12 @@ Python Comparison:
 
 #include <iostream>
 #include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <climits>
 using namespace std;
 
 //==============================================================================
@@ -319,7 +325,27 @@ void destroyQueue(Queue<T>* queue) {
 }
 
 //==============================================================================
-// PART 3: CUSTOM DATA TYPE EXAMPLE
+// PART 3: FIXED-CAPACITY STACK (NON-TYPE TEMPLATE PARAMETER)
+//==============================================================================
+
+/*
+STATIC STACK - Template with a TYPE and a NUMBER
+------------------------------------------------
+The StaticStack from Week 4 (included from Week 4/staticStack.h, so there
+is one definition of it). Templates can take values too: StaticStack<int, 64>
+is a stack of at most 64 ints, and the array size N is known at compile
+time, so the whole stack lives inside the variable - no new/delete, no nodes.
+
+    StaticStack<int, 64> s = {};     // 64 ints + a counter, on the frame
+
+push/pop/peek are checked (return false on overflow/underflow); the
+*_unchecked versions are for loops that already know the access is safe.
+All operations are constexpr (C++14).
+*/
+#include "../../Week 4/staticStack.h"
+
+//==============================================================================
+// PART 4: CUSTOM DATA TYPE EXAMPLE
 //==============================================================================
 
 /*
@@ -527,7 +553,7 @@ void demonstrateSpecialization() {
 }
 
 //==============================================================================
-// PRACTICAL APPLICATION: Expression Evaluator
+// PRACTICAL APPLICATION: Expression Evaluator (on StaticStack)
 //==============================================================================
 
 void demonstrateApplication() {
@@ -536,51 +562,233 @@ void demonstrateApplication() {
     cout << "====================================================\n\n";
     
     // Expression: 5 3 + 2 *  (means: (5+3)*2 = 16)
-    Stack<int> calcStack;
-    initStack(&calcStack);
+    // Same StaticStack the evaluators below use: no new/delete per push
+    StaticStack<int, 8> calcStack = {};
     
     cout << "RPN Expression: 5 3 + 2 *\n";
     cout << "Calculation steps:\n";
     
     // Push 5
-    push(&calcStack, 5);
+    push_unchecked(&calcStack, 5);
     cout << "  Push 5: ";
-    displayStack(&calcStack);
+    display(&calcStack);
     
     // Push 3
-    push(&calcStack, 3);
+    push_unchecked(&calcStack, 3);
     cout << "  Push 3: ";
-    displayStack(&calcStack);
+    display(&calcStack);
     
     // Addition (+)
-    int b = pop(&calcStack);
-    int a = pop(&calcStack);
-    push(&calcStack, a + b);
+    int b = pop_unchecked(&calcStack);
+    int a = pop_unchecked(&calcStack);
+    push_unchecked(&calcStack, a + b);
     cout << "  Operator +: pop " << b << " and " << a << ", push " << (a+b) << ": ";
-    displayStack(&calcStack);
+    display(&calcStack);
     
     // Push 2
-    push(&calcStack, 2);
+    push_unchecked(&calcStack, 2);
     cout << "  Push 2: ";
-    displayStack(&calcStack);
+    display(&calcStack);
     
     // Multiplication (*)
-    b = pop(&calcStack);
-    a = pop(&calcStack);
-    push(&calcStack, a * b);
+    b = pop_unchecked(&calcStack);
+    a = pop_unchecked(&calcStack);
+    push_unchecked(&calcStack, a * b);
     cout << "  Operator *: pop " << b << " and " << a << ", push " << (a*b) << ": ";
-    displayStack(&calcStack);
+    display(&calcStack);
     
-    cout << "\nResult: " << pop(&calcStack) << endl;
+    cout << "\nResult: " << pop_unchecked(&calcStack) << endl;
+}
+
+/*
+RPN EVALUATOR ON A STATIC STACK
+-------------------------------
+Tokens are separated by spaces: integers and the operators + - * /.
+Returns false for malformed input (too few operands, leftovers, too deep,
+division by zero, a number or result that does not fit in an int) instead
+of crashing or wrapping around.
+
+The operand stack is a StaticStack<int, 64> local variable, so evaluating
+an expression never allocates memory.
+*/
+const int RPN_MAX_DEPTH = 64;
+
+bool isOperator(char c) {
+    return c == '+' || c == '-' || c == '*' || c == '/';
+}
+
+// False when a op b has no int result: division by zero, or a value
+// outside [INT_MIN, INT_MAX] (this includes INT_MIN / -1)
+bool applyOperator(char op, int a, int b, int* result) {
+    long long value;
+    switch (op) {
+        case '+': value = (long long)a + b; break;
+        case '-': value = (long long)a - b; break;
+        case '*': value = (long long)a * b; break;
+        default:
+            if (b == 0)
+                return false;
+            value = (long long)a / b;
+    }
+    if (value < INT_MIN || value > INT_MAX)
+        return false;
+    *result = (int)value;
+    return true;
+}
+
+// Reads the integer at p into *value; NULL if there is none or it does
+// not fit in an int
+const char* parseOperand(const char* p, int* value) {
+    char* end;
+    errno = 0;
+    long parsed = strtol(p, &end, 10);
+    if (end == p || errno == ERANGE || parsed < INT_MIN || parsed > INT_MAX)
+        return NULL;
+    *value = (int)parsed;
+    return end;
+}
+
+bool evaluateRPN(const string& expr, int* result) {
+    StaticStack<int, RPN_MAX_DEPTH> stack = {};
+    const char* p = expr.c_str();
+    
+    while (*p != '\0') {
+        if (*p == ' ') {
+            p++;
+        } else if (isOperator(*p) && (p[1] == ' ' || p[1] == '\0')) {
+            int b, a, value;
+            if (!pop(&stack, &b) || !pop(&stack, &a))
+                return false;                      // Not enough operands
+            if (!applyOperator(*p, a, b, &value))
+                return false;                      // Division by zero or overflow
+            push_unchecked(&stack, value);         // Just popped 2
+            p++;
+        } else {
+            int value;
+            const char* end = parseOperand(p, &value);
+            if (end == NULL || !push(&stack, value))
+                return false;                      // Bad token or too deep
+            p = end;
+        }
+    }
+    if (size(&stack) != 1)
+        return false;
+    *result = pop_unchecked(&stack);
+    return true;
+}
+
+/*
+Same evaluator on the linked Stack<T> from PART 1 (one new/delete per
+push/pop), used as the baseline in the benchmark.
+*/
+bool evaluateRPNLinked(const string& expr, int* result) {
+    Stack<int> stack;
+    initStack(&stack);
+    const char* p = expr.c_str();
+    bool ok = true;
+    
+    while (*p != '\0' && ok) {
+        if (*p == ' ') {
+            p++;
+        } else if (isOperator(*p) && (p[1] == ' ' || p[1] == '\0')) {
+            if (getStackSize(&stack) < 2) {
+                ok = false;
+            } else {
+                int b = pop(&stack);
+                int a = pop(&stack);
+                int value;
+                ok = applyOperator(*p, a, b, &value);
+                if (ok)
+                    push(&stack, value);
+                p++;
+            }
+        } else {
+            int value;
+            const char* end = parseOperand(p, &value);
+            if (end == NULL) {
+                ok = false;                        // Bad token: stop here
+            } else {
+                push(&stack, value);
+                p = end;
+            }
+        }
+    }
+    ok = ok && getStackSize(&stack) == 1;
+    if (ok)
+        *result = pop(&stack);
+    destroyStack(&stack);
+    return ok;
+}
+
+void demonstrateStaticStackEvaluator() {
+    cout << "\n====================================================\n";
+    cout << "  APPLICATION: RPN Evaluator on StaticStack<int, 64>\n";
+    cout << "====================================================\n\n";
     
-    destroyStack(&calcStack);
+    string expressions[] = {"5 3 + 2 *", "2 3 4 * +", "100 7 - 3 /", "12 -4 *", "1 +", "1 2 3", "4 0 /",
+                            "2147483647 1 +", "-2147483648 -1 /", "99999999999 1 *",
+                            "1 x +"};
+    for (const string& expr : expressions) {
+        int result, linkedResult;
+        bool valid = evaluateRPN(expr, &result);
+        if (valid != evaluateRPNLinked(expr, &linkedResult) || (valid && result != linkedResult))
+            printf("  %-18s   Error: linked evaluator disagrees\n", expr.c_str());
+        if (valid)
+            printf("  %-18s = %d\n", expr.c_str(), result);
+        else
+            printf("  %-18s   invalid expression\n", expr.c_str());
+    }
+}
+
+//==============================================================================
+// BENCHMARK: STATIC STACK vs LINKED STACK
+//==============================================================================
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+void benchmark() {
+    // "5 1 2 + - 3 4 * - ..." : stays shallow, never overflows an int
+    string expr = "5";
+    for (int i = 0; i < 200; i++)
+        expr += " " + to_string(i % 9 + 1) + " " + to_string(i % 7 + 1) + (i % 2 ? " + -" : " * -");
+    const int runs = 20000;
+    
+    int expected = 0, result = 0;
+    if (!evaluateRPN(expr, &expected) || !evaluateRPNLinked(expr, &result) || result != expected) {
+        cout << "Error: evaluators disagree" << endl;
+        return;
+    }
+    
+    long long check = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++) {
+        evaluateRPNLinked(expr, &result);
+        check += result;
+    }
+    double linkedTime = secondsSince(start);
+    
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++) {
+        evaluateRPN(expr, &result);
+        check -= result;
+    }
+    double staticTime = secondsSince(start);
+    
+    int tokens = 1 + 200 * 4;
+    cout << "\n" << runs << " evaluations of a " << tokens << "-token RPN expression\n";
+    printf("  Linked Stack<int>:          %7.1f M tokens/sec\n", (double)runs * tokens / linkedTime / 1e6);
+    printf("  StaticStack<int, 64>:       %7.1f M tokens/sec\n", (double)runs * tokens / staticTime / 1e6);
+    if (check != 0)
+        cout << "Error: results differ between runs" << endl;
 }
 
 //==============================================================================
 // MAIN FUNCTION
 //==============================================================================
 
-int main() {
+int main(int argc, char* argv[]) {
     cout << "========================================================\n";
     cout << "  TASK 3: UTILIZING TEMPLATES ON STACK AND QUEUE\n";
     cout << "========================================================\n";
@@ -589,11 +797,15 @@ int main() {
     demonstrateQueueTemplates();
     demonstrateSpecialization();
     demonstrateApplication();
+    demonstrateStaticStackEvaluator();
     
     cout << "\n========================================================\n";
     cout << "  Template demonstrations completed!\n";
     cout << "========================================================\n\n";
     
+    // ./task3 bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
     return 0;
 }
 
@@ -693,7 +905,8 @@ Python achieves genericity through dynamic typing.
 
 ================================================================================
 COMPILATION AND EXECUTION:
-   g++ -std=c++11 task3_templates.cpp -o task3
+   g++ -std=c++14 task3_templates.cpp -o task3
    ./task3
+   ./task3 bench      (RPN evaluation: StaticStack vs linked Stack)
 ================================================================================
 */
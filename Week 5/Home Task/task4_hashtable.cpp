@@ -48,6 +48,18 @@ Python Comparison:
 
 #include <iostream>
 #include <string>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#ifdef __SSE2__
+#include <emmintrin.h>  // SSE2 intrinsics for the Swiss table
+#endif
+#include "../../log_policy.h"
 using namespace std;
 
 //==============================================================================
@@ -77,6 +89,10 @@ With DELETED:
     Search "Bob" → starts at 5, sees DELETED, continues probing → finds Bob!
 */
 
+// The insert/delete functions print only when their Log policy says so
+// (linearInsert<VerboseLog>(...)); -DTEACHING_MODE makes that the default
+// (see log_policy.h).
+
 //==============================================================================
 // HASH TABLE ENTRY
 //==============================================================================
@@ -86,8 +102,9 @@ struct HashEntry {
     K key;               // The key (e.g., "Alice")
     V value;             // The value (e.g., phone number)
     CellStatus status;   // EMPTY, OCCUPIED, or DELETED
+    int probeDist;       // Distance from the key's home index (0 = at home)
     
-    HashEntry() : status(EMPTY) {}  // Default constructor
+    HashEntry() : status(EMPTY), probeDist(0) {}  // Default constructor
 };
 
 //==============================================================================
@@ -114,36 +131,46 @@ struct HashTable {
 //==============================================================================
 
 /*
-HASH FUNCTION FOR INTEGERS
----------------------------
-Simple modulo hash: key % table_size
-
-Example: hash(25) = 25 % 11 = 3
+WHY NOT THE SIMPLE HASHES?
+--------------------------
+hashStringPolynomial() below is the textbook version: it does an integer
+division (% tableSize) for EVERY character, and because the result is
+always smaller than tableSize it only ever has log2(tableSize) bits of
+state - similar keys ("user1000", "user1001") land next to each other.
+
+The real hash functions work in two steps:
+    1. Mix the whole key into a 64-bit number (fast, well spread)
+    2. Reduce that number to an index ONCE: reduceRange / reduceMask
+
+PLUGGABLE HASHER:
+    hashFunction<K>() asks Hasher<K> for the 64-bit hash. Hasher is
+    specialized for int, 64-bit integers and string; to store your own key
+    type, specialize it:
+
+        template <>
+        struct Hasher<Student> {
+            unsigned long long operator()(const Student& s) const {
+                return Hasher<int>()(s.id);
+            }
+        };
 */
-int hashInt(int key, int tableSize) {
-    return key % tableSize;
-}
 
 /*
-HASH FUNCTION FOR STRINGS
---------------------------
-Convert string to number, then modulo
-
+TEXTBOOK POLYNOMIAL HASH (kept for comparison)
+----------------------------------------------
 Algorithm: Polynomial rolling hash
     hash = (s[0] * 31^(n-1) + s[1] * 31^(n-2) + ... + s[n-1]) % tableSize
-    
-Simplified version for educational purposes:
 */
-int hashString(const string& key, int tableSize) {
+int hashStringPolynomial(const string& key, int tableSize) {
     int hash = 0;
-    for (int i = 0; i < key.length(); i++) {
+    for (int i = 0; i < (int)key.length(); i++) {
         hash = (hash * 31 + key[i]) % tableSize;
     }
     return hash;
     
     /*
     EXAMPLE:
-    hashString("Alice", 11)
+    hashStringPolynomial("Alice", 11)
     
     hash = 0
     hash = (0 * 31 + 'A') % 11 = 65 % 11 = 10
@@ -156,12 +183,199 @@ int hashString(const string& key, int tableSize) {
     */
 }
 
-// Generic hash function (we'll use string version)
+/*
+64x64 → 128-bit MULTIPLY, FOLDED TO 64 BITS
+-------------------------------------------
+The low and high halves of a full product XORed together: every input bit
+affects every output bit. This is the mixing step of wyhash.
+*/
+inline unsigned long long mulFold(unsigned long long a, unsigned long long b) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = (unsigned __int128)a * b;
+    return (unsigned long long)r ^ (unsigned long long)(r >> 64);
+#else
+    // Portable version: multiply 32-bit halves
+    unsigned long long aLo = a & 0xFFFFFFFFULL, aHi = a >> 32;
+    unsigned long long bLo = b & 0xFFFFFFFFULL, bHi = b >> 32;
+    unsigned long long lo = aLo * bLo, mid1 = aLo * bHi, mid2 = aHi * bLo, hi = aHi * bHi;
+    unsigned long long carry = ((lo >> 32) + (mid1 & 0xFFFFFFFFULL) + (mid2 & 0xFFFFFFFFULL)) >> 32;
+    unsigned long long low64 = a * b;
+    unsigned long long high64 = hi + (mid1 >> 32) + (mid2 >> 32) + carry;
+    return low64 ^ high64;
+#endif
+}
+
+const unsigned long long HASH_P0 = 0xa0761d6478bd642fULL;
+const unsigned long long HASH_P1 = 0xe7037ed1a0b428dbULL;
+const unsigned long long HASH_P2 = 0x8ebc6af09c88c6e3ULL;
+const unsigned long long HASH_P3 = 0x589965cc75374cc3ULL;
+
+inline unsigned long long read64(const unsigned char* p) {
+    unsigned long long v;
+    memcpy(&v, p, 8);  // Unaligned-safe; compiles to one load
+    return v;
+}
+
+inline unsigned long long read32(const unsigned char* p) {
+    unsigned int v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+/*
+WORD-AT-A-TIME BYTE HASH (wyhash-style)
+---------------------------------------
+Reads the key 8 or 16 bytes at a time instead of one character at a
+time, and never divides. Short keys (≤ 16 bytes, most names and IDs) take
+a couple of overlapping loads and two multiplies.
+*/
+unsigned long long hashBytes(const void* key, size_t len, unsigned long long seed = 0) {
+    const unsigned char* p = (const unsigned char*)key;
+    unsigned long long a, b;
+    seed ^= mulFold(seed ^ HASH_P0, HASH_P1);
+    
+    if (len <= 16) {
+        if (len >= 4) {
+            // Two (possibly overlapping) pairs of 4-byte reads cover 4..16 bytes
+            size_t mid = (len >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + mid);
+            b = (read32(p + len - 4) << 32) | read32(p + len - 4 - mid);
+        }
+        else if (len > 0) {
+            a = ((unsigned long long)p[0] << 16) | ((unsigned long long)p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        size_t remaining = len;
+        if (remaining > 48) {
+            // Three independent lanes keep the multiplier busy on long keys
+            unsigned long long lane1 = seed, lane2 = seed;
+            do {
+                seed = mulFold(read64(p) ^ HASH_P1, read64(p + 8) ^ seed);
+                lane1 = mulFold(read64(p + 16) ^ HASH_P2, read64(p + 24) ^ lane1);
+                lane2 = mulFold(read64(p + 32) ^ HASH_P3, read64(p + 40) ^ lane2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (remaining > 16) {
+            seed = mulFold(read64(p) ^ HASH_P1, read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        // Last 16 bytes (may overlap bytes already hashed)
+        a = read64(p + remaining - 16);
+        b = read64(p + remaining - 8);
+    }
+    
+    return mulFold(HASH_P1 ^ len, mulFold(a ^ HASH_P1, b ^ seed));
+}
+
+// Mix a 64-bit integer: one multiply-fold
+inline unsigned long long hashInteger(unsigned long long key) {
+    return mulFold(key ^ HASH_P0, HASH_P1);
+}
+
+/*
+REDUCING A 64-BIT HASH TO AN INDEX
+----------------------------------
+reduceRange: "fastrange" - (hash * n) / 2^64, using the top 32 bits of the
+             hash. Maps uniformly onto [0, n) for ANY n (prime or not)
+             with one multiply instead of a division.
+reduceMask:  hash & (n - 1) - for power-of-two sizes only.
+*/
+inline int reduceRange(unsigned long long hash, int n) {
+    return (int)(((hash >> 32) * (unsigned long long)n) >> 32);
+}
+
+inline int reduceMask(unsigned long long hash, int mask) {
+    return (int)(hash & (unsigned long long)mask);
+}
+
+//==============================================================================
+// PLUGGABLE HASHER
+//==============================================================================
+
+template <typename K>
+struct Hasher;  // Specialize for each key type (see above)
+
+template <>
+struct Hasher<int> {
+    unsigned long long operator()(int key) const {
+        return hashInteger((unsigned int)key);
+    }
+};
+
+template <>
+struct Hasher<unsigned int> {
+    unsigned long long operator()(unsigned int key) const {
+        return hashInteger(key);
+    }
+};
+
+template <>
+struct Hasher<long> {
+    unsigned long long operator()(long key) const {
+        return hashInteger((unsigned long long)key);
+    }
+};
+
+template <>
+struct Hasher<long long> {
+    unsigned long long operator()(long long key) const {
+        return hashInteger((unsigned long long)key);
+    }
+};
+
+// size_t is unsigned long on LP64 systems and unsigned long long on Windows
+template <>
+struct Hasher<unsigned long> {
+    unsigned long long operator()(unsigned long key) const {
+        return hashInteger(key);
+    }
+};
+
+template <>
+struct Hasher<unsigned long long> {
+    unsigned long long operator()(unsigned long long key) const {
+        return hashInteger(key);
+    }
+};
+
+template <>
+struct Hasher<string> {
+    unsigned long long operator()(const string& key) const {
+        return hashBytes(key.data(), key.size());
+    }
+};
+
+/*
+HASH FUNCTION FOR INTEGERS
+---------------------------
+Example: hashInt(25, 11) → mix 25 into 64 bits, then reduceRange(…, 11)
+*/
+int hashInt(int key, int tableSize) {
+    return reduceRange(Hasher<int>()(key), tableSize);
+}
+
+/*
+HASH FUNCTION FOR STRINGS
+--------------------------
+One pass over the bytes, one reduction at the end.
+*/
+int hashString(const string& key, int tableSize) {
+    return reduceRange(Hasher<string>()(key), tableSize);
+}
+
+// Generic hash function: any key type with a Hasher<K> specialization
 template <typename K>
-int hashFunction(K key, int tableSize) {
-    // For demonstration, we'll assume K is string
-    // In real implementation, you'd specialize for different types
-    return hashString(key, tableSize);
+int hashFunction(const K& key, int tableSize) {
+    return reduceRange(Hasher<K>()(key), tableSize);
 }
 
 //==============================================================================
@@ -215,10 +429,11 @@ struct LinearProbingHashTable {
 INSERT WITH LINEAR PROBING
 ---------------------------
 */
-template <typename K, typename V>
+template <typename Log = DefaultLog, typename K, typename V>
 void linearInsert(LinearProbingHashTable<K, V>* ht, K key, V value) {
     if (ht->size >= ht->capacity) {
-        cout << "Error: Hash table is full!" << endl;
+        if (Log::enabled)
+            cout << "Error: Hash table is full!" << endl;
         return;
     }
     
@@ -250,13 +465,16 @@ void linearInsert(LinearProbingHashTable<K, V>* ht, K key, V value) {
             ht->table[probedIndex].key = key;
             ht->table[probedIndex].value = value;
             ht->table[probedIndex].status = OCCUPIED;
+            ht->table[probedIndex].probeDist = i;
             ht->size++;
             
-            cout << "  Inserted '" << key << "' at index " << probedIndex;
-            if (i > 0) {
-                cout << " (after " << i << " probes)";
+            if (Log::enabled) {
+                cout << "  Inserted '" << key << "' at index " << probedIndex;
+                if (i > 0) {
+                    cout << " (after " << i << " probes)";
+                }
+                cout << endl;
             }
-            cout << endl;
             return;
         }
         
@@ -264,52 +482,60 @@ void linearInsert(LinearProbingHashTable<K, V>* ht, K key, V value) {
         if (ht->table[probedIndex].status == OCCUPIED && 
             ht->table[probedIndex].key == key) {
             ht->table[probedIndex].value = value;
-            cout << "  Updated '" << key << "' at index " << probedIndex << endl;
+            if (Log::enabled)
+                cout << "  Updated '" << key << "' at index " << probedIndex << endl;
             return;
         }
         
         i++;  // Try next position
     }
     
-    cout << "Error: Could not insert (table full)" << endl;
+    if (Log::enabled)
+        cout << "Error: Could not insert (table full)" << endl;
 }
 
 /*
 SEARCH WITH LINEAR PROBING
 ---------------------------
 */
+// Slot index of key (or -1), starting from a precomputed home index.
+// Shared by linearSearch and linearLookupBatch.
 template <typename K, typename V>
-bool linearSearch(LinearProbingHashTable<K, V>* ht, K key, V* result) {
-    int index = hashFunction(key, ht->capacity);
-    int i = 0;
-    
-    while (i < ht->capacity) {
-        int probedIndex = (index + i) % ht->capacity;
+int linearFindFrom(LinearProbingHashTable<K, V>* ht, const K& key, int home) {
+    for (int i = 0; i < ht->capacity; i++) {
+        int probedIndex = home + i < ht->capacity ? home + i : home + i - ht->capacity;
+        const HashEntry<K, V>& entry = ht->table[probedIndex];
         
         // If empty (never used), key doesn't exist
-        if (ht->table[probedIndex].status == EMPTY) {
-            return false;
+        if (entry.status == EMPTY) {
+            return -1;
         }
         
         // If occupied and key matches, found it!
-        if (ht->table[probedIndex].status == OCCUPIED && 
-            ht->table[probedIndex].key == key) {
-            *result = ht->table[probedIndex].value;
-            return true;
+        if (entry.status == OCCUPIED && entry.key == key) {
+            return probedIndex;
         }
         
         // If deleted or wrong key, continue probing
-        i++;
     }
-    
-    return false;  // Not found after checking entire table
+    return -1;  // Not found after checking entire table
+}
+
+template <typename K, typename V>
+bool linearSearch(LinearProbingHashTable<K, V>* ht, K key, V* result) {
+    int slot = linearFindFrom(ht, key, hashFunction(key, ht->capacity));
+    if (slot == -1) {
+        return false;
+    }
+    *result = ht->table[slot].value;
+    return true;
 }
 
 /*
 DELETE WITH LINEAR PROBING
 ---------------------------
 */
-template <typename K, typename V>
+template <typename Log = DefaultLog, typename K, typename V>
 bool linearDelete(LinearProbingHashTable<K, V>* ht, K key) {
     int index = hashFunction(key, ht->capacity);
     int i = 0;
@@ -327,7 +553,8 @@ bool linearDelete(LinearProbingHashTable<K, V>* ht, K key) {
             // Mark as DELETED (not EMPTY!)
             ht->table[probedIndex].status = DELETED;
             ht->size--;
-            cout << "  Deleted '" << key << "' from index " << probedIndex << endl;
+            if (Log::enabled)
+                cout << "  Deleted '" << key << "' from index " << probedIndex << endl;
             return true;
         }
         
@@ -364,6 +591,216 @@ void displayLinear(LinearProbingHashTable<K, V>* ht) {
     cout << "Size: " << ht->size << "/" << ht->capacity << endl;
 }
 
+//==============================================================================
+// ROBIN HOOD PROBING (LINEAR PROBING VARIANT)
+//==============================================================================
+
+/*
+ROBIN HOOD HASHING
+------------------
+Same probe sequence as linear probing (index, index+1, index+2, ...), but
+every entry remembers how far it is from its home index (probeDist).
+
+Rule on insert: "take from the rich, give to the poor"
+    While probing, if the key we are carrying is FURTHER from home than
+    the entry sitting in the slot, swap them and keep probing with the
+    evicted entry.
+
+Example (capacity 11):
+    Slot:      5        6        7
+    Entry:   [A d=0] [B d=1] [C d=0]    (C's home is 7)
+    Insert X with home 5:
+        slot 5: A has d=0, X has d=0 → keep going
+        slot 6: B has d=1, X has d=1 → keep going
+        slot 7: C has d=0, X has d=2 → X is poorer, X takes slot 7
+                and C continues to slot 8 with d=1
+
+RESULT:
+    Probe distances become very even - no key is left with a huge
+    distance while others sit at home. The worst case at 0.9 load drops
+    from hundreds of probes to a few dozen.
+
+EARLY EXIT ON SEARCH:
+    If we reach a slot whose entry is CLOSER to home than we are
+    (entry.probeDist < our distance), the key cannot be further along,
+    because insert would have swapped it in here. Stop!
+
+BACKWARD-SHIFT DELETION:
+    No DELETED tombstones. After removing an entry, shift the following
+    entries back one slot (decrementing their probeDist) until we hit an
+    EMPTY slot or an entry that is already at home (probeDist == 0).
+
+NOTE: Use either the linear* or the robinHood* functions on a table, not both.
+*/
+
+/*
+SEARCH WITH ROBIN HOOD PROBING
+------------------------------
+Returns the slot index, or -1 if the key is not in the table.
+*/
+template <typename K, typename V>
+int robinHoodFind(LinearProbingHashTable<K, V>* ht, const K& key) {
+    int index = hashFunction(key, ht->capacity);
+    
+    for (int dist = 0; dist < ht->capacity; dist++) {
+        HashEntry<K, V>& entry = ht->table[index];
+        
+        // Empty slot, or entry closer to home than we are → not present
+        if (entry.status != OCCUPIED || entry.probeDist < dist) {
+            return -1;
+        }
+        if (entry.key == key) {
+            return index;
+        }
+        index = (index + 1) % ht->capacity;
+    }
+    
+    return -1;
+}
+
+/*
+INSERT WITH ROBIN HOOD PROBING
+------------------------------
+Returns false only if the table is full.
+*/
+template <typename K, typename V>
+bool robinHoodInsert(LinearProbingHashTable<K, V>* ht, K key, V value) {
+    if (ht->size >= ht->capacity) {
+        // Full: the only thing we can still do is update an existing key
+        int existing = robinHoodFind(ht, key);
+        if (existing == -1) {
+            return false;
+        }
+        ht->table[existing].value = value;
+        return true;
+    }
+    
+    int index = hashFunction(key, ht->capacity);
+    int dist = 0;
+    bool carryingNewKey = true;  // false once the new key has been placed
+    
+    // There is at least one free slot, so this loop always ends
+    while (true) {
+        HashEntry<K, V>& entry = ht->table[index];
+        
+        if (entry.status != OCCUPIED) {
+            entry.key = key;
+            entry.value = value;
+            entry.status = OCCUPIED;
+            entry.probeDist = dist;
+            ht->size++;
+            return true;
+        }
+        
+        // Key already present: update in place
+        // (only possible before the first swap, see EARLY EXIT above)
+        if (carryingNewKey && entry.key == key) {
+            entry.value = value;
+            return true;
+        }
+        
+        // Entry here is "richer" (closer to home) - it gives up its slot
+        if (entry.probeDist < dist) {
+            swap(entry.key, key);
+            swap(entry.value, value);
+            swap(entry.probeDist, dist);
+            carryingNewKey = false;
+        }
+        
+        index = (index + 1) % ht->capacity;
+        dist++;
+    }
+}
+
+template <typename K, typename V>
+bool robinHoodSearch(LinearProbingHashTable<K, V>* ht, K key, V* result) {
+    int index = robinHoodFind(ht, key);
+    if (index == -1) {
+        return false;
+    }
+    *result = ht->table[index].value;
+    return true;
+}
+
+/*
+DELETE WITH BACKWARD SHIFT
+--------------------------
+Before deleting B (home of C is 5, so C has d=2):
+    Slot:    5       6       7       8
+           [A d=0] [B d=1] [C d=2] [EMPTY]
+After:
+           [A d=0] [C d=1] [EMPTY] [EMPTY]
+*/
+template <typename K, typename V>
+bool robinHoodDelete(LinearProbingHashTable<K, V>* ht, K key) {
+    int index = robinHoodFind(ht, key);
+    if (index == -1) {
+        return false;
+    }
+    
+    int next = (index + 1) % ht->capacity;
+    while (ht->table[next].status == OCCUPIED && ht->table[next].probeDist > 0) {
+        ht->table[index] = ht->table[next];
+        ht->table[index].probeDist--;
+        index = next;
+        next = (next + 1) % ht->capacity;
+    }
+    
+    ht->table[index].status = EMPTY;
+    ht->table[index].probeDist = 0;
+    ht->size--;
+    return true;
+}
+
+/*
+PROBE-LENGTH HISTOGRAM
+----------------------
+Counts how many occupied entries sit at each distance from home.
+Works for both linear* and robinHood* tables because both store probeDist.
+*/
+template <typename K, typename V>
+void probeHistogram(LinearProbingHashTable<K, V>* ht, const string& label) {
+    const int BUCKETS = 17;  // 0..15, then "16+"
+    int counts[BUCKETS] = {0};
+    int maxDist = 0;
+    long long totalDist = 0;
+    
+    for (int i = 0; i < ht->capacity; i++) {
+        if (ht->table[i].status != OCCUPIED) continue;
+        int d = ht->table[i].probeDist;
+        counts[d < BUCKETS - 1 ? d : BUCKETS - 1]++;
+        totalDist += d;
+        if (d > maxDist) maxDist = d;
+    }
+    
+    cout << "\n" << label << " (" << ht->size << "/" << ht->capacity << " slots used)\n";
+    cout << "Dist | Count | Histogram\n";
+    cout << "-----|-------|----------\n";
+    for (int d = 0; d < BUCKETS; d++) {
+        if (d < BUCKETS - 1) {
+            cout << (d < 10 ? "   " : "  ") << d << " | ";
+        } else {
+            cout << " 16+ | ";
+        }
+        string count = to_string(counts[d]);
+        cout << string(5 - min(5, (int)count.length()), ' ') << count << " | ";
+        cout << string(counts[d] * 50 / max(1, ht->size), '#') << "\n";
+    }
+    cout << "Average probe distance: " << (ht->size ? (double)totalDist / ht->size : 0.0) << endl;
+    cout << "Worst probe distance:   " << maxDist << endl;
+}
+
+// Smallest prime >= n (table capacities)
+int nextPrime(int n) {
+    for (;; n++) {
+        bool prime = n > 1;
+        for (int d = 2; d * d <= n && prime; d++) {
+            if (n % d == 0) prime = false;
+        }
+        if (prime) return n;
+    }
+}
+
 //==============================================================================
 // QUADRATIC PROBING HASH TABLE
 //==============================================================================
@@ -398,15 +835,44 @@ DISADVANTAGES:
 IMPORTANT: Table size should be prime for quadratic probing to work well!
 */
 
+/*
+TOMBSTONE BUILD-UP
+------------------
+Every quadraticDelete() leaves a DELETED cell behind. Searches must walk
+past them, so after a long delete/insert churn most cells are DELETED,
+hardly any are EMPTY, and an unsuccessful search probes the whole
+sequence before giving up.
+
+Fix: count tombstones and rebuild the table (re-insert only the live
+entries into a fresh array of the same capacity, or a larger one if they
+no longer fit) once they pass maxTombstoneFraction of the capacity. The rebuild costs O(capacity) but
+only happens every (maxTombstoneFraction * capacity) deletes, so it is
+O(1) amortized per delete.
+*/
+const double MAX_TOMBSTONE_FRACTION = 0.2;
+
 template <typename K, typename V>
 struct QuadraticProbingHashTable {
     HashEntry<K, V>* table;
     int capacity;
-    int size;
+    int size;                       // Live (OCCUPIED) entries
+    int tombstones;                 // DELETED cells
+    double maxTombstoneFraction;    // Rebuild when tombstones > this * capacity
     
-    QuadraticProbingHashTable(int cap = TABLE_SIZE) {
+    // Statistics (see quadraticStats)
+    long long searches;             // Lookups (quadraticSearch or batch)
+    long long searchProbes;         // Cells examined by those searches
+    int rebuilds;                   // Times the table was compacted
+    
+    QuadraticProbingHashTable(int cap = TABLE_SIZE,
+                              double maxTombstones = MAX_TOMBSTONE_FRACTION) {
         capacity = cap;
         size = 0;
+        tombstones = 0;
+        maxTombstoneFraction = maxTombstones;
+        searches = 0;
+        searchProbes = 0;
+        rebuilds = 0;
         table = new HashEntry<K, V>[capacity];
     }
     
@@ -415,23 +881,89 @@ struct QuadraticProbingHashTable {
     }
 };
 
+// Cell i of the quadratic probe sequence from home. i * i is done in 64
+// bits: in int it overflows once capacity passes ~46341.
+inline int quadraticProbe(int home, int i, int capacity) {
+    return (int)((home + (long long)i * i) % capacity);
+}
+
 /*
-INSERT WITH QUADRATIC PROBING
-------------------------------
+REBUILD (COMPACTION)
+--------------------
+Re-insert all OCCUPIED entries into a fresh array of newCapacity cells;
+every DELETED cell becomes EMPTY again. Returns false (and keeps the old
+table) if an entry cannot be placed - quadratic probing only guarantees a
+free cell within the sequence while the table is at most half full.
+
+This copies into a second array rather than compacting in place: moving
+entries inside the same array would need a "not re-placed yet" mark per
+cell, and since a rebuild only runs every few hundred deletes the extra
+array is a small price.
 */
 template <typename K, typename V>
-void quadraticInsert(QuadraticProbingHashTable<K, V>* ht, K key, V value) {
-    if (ht->size >= ht->capacity) {
-        cout << "Error: Hash table is full!" << endl;
-        return;
+bool quadraticRebuild(QuadraticProbingHashTable<K, V>* ht, int newCapacity) {
+    HashEntry<K, V>* fresh = new HashEntry<K, V>[newCapacity];
+    
+    for (int j = 0; j < ht->capacity; j++) {
+        if (ht->table[j].status != OCCUPIED) continue;
+        
+        int index = hashFunction(ht->table[j].key, newCapacity);
+        bool placed = false;
+        for (int i = 0; i < newCapacity; i++) {
+            int probedIndex = quadraticProbe(index, i, newCapacity);
+            if (fresh[probedIndex].status == EMPTY) {
+                fresh[probedIndex] = ht->table[j];
+                fresh[probedIndex].probeDist = i;
+                placed = true;
+                break;
+            }
+        }
+        if (!placed) {
+            delete[] fresh;
+            return false;
+        }
     }
     
+    delete[] ht->table;
+    ht->table = fresh;
+    ht->capacity = newCapacity;
+    ht->tombstones = 0;
+    ht->rebuilds++;
+    return true;
+}
+
+/*
+Runs when tombstones pass the threshold. If the live entries cannot all be
+placed at the current capacity, the table grows to a prime of at least
+twice the size instead. At most half full, quadratic probing on a prime
+capacity always finds a free cell, so the rebuild succeeds and tombstones
+are reset; a failed rebuild is never retried on every later delete.
+*/
+template <typename K, typename V>
+void quadraticCompact(QuadraticProbingHashTable<K, V>* ht) {
+    int capacity = ht->capacity;
+    while (!quadraticRebuild(ht, capacity)) {
+        capacity = nextPrime(2 * capacity + 1);
+    }
+}
+
+/*
+INSERT WITH QUADRATIC PROBING
+------------------------------
+The first DELETED cell on the way is remembered, but we keep probing until
+EMPTY: the key may already exist further along the sequence (inserted
+before the cell was deleted), and stopping early would store it twice.
+*/
+template <typename Log = DefaultLog, typename K, typename V>
+void quadraticInsert(QuadraticProbingHashTable<K, V>* ht, K key, V value) {
     int index = hashFunction(key, ht->capacity);
     int i = 0;
+    int reuseIndex = -1;  // First DELETED cell seen
+    int reuseStep = 0;
     
     while (i < ht->capacity) {
         // Quadratic probing: (index + i²) % capacity
-        int probedIndex = (index + i * i) % ht->capacity;
+        int probedIndex = quadraticProbe(index, i, ht->capacity);
         
         /*
         QUADRATIC SEQUENCE EXAMPLE:
@@ -447,51 +979,112 @@ void quadraticInsert(QuadraticProbingHashTable<K, V>* ht, K key, V value) {
         Notice: Not sequential! Reduces clustering.
         */
         
-        if (ht->table[probedIndex].status == EMPTY || 
-            ht->table[probedIndex].status == DELETED) {
-            
-            ht->table[probedIndex].key = key;
-            ht->table[probedIndex].value = value;
-            ht->table[probedIndex].status = OCCUPIED;
-            ht->size++;
-            
-            cout << "  Inserted '" << key << "' at index " << probedIndex;
-            if (i > 0) {
-                cout << " (after " << i << " probes, sequence: ";
-                for (int j = 0; j <= i; j++) {
-                    cout << (index + j * j) % ht->capacity;
-                    if (j < i) cout << "→";
-                }
-                cout << ")";
-            }
-            cout << endl;
-            return;
+        if (ht->table[probedIndex].status == EMPTY) {
+            break;  // Key is not in the table
         }
         
-        if (ht->table[probedIndex].status == OCCUPIED && 
-            ht->table[probedIndex].key == key) {
+        if (ht->table[probedIndex].status == DELETED) {
+            if (reuseIndex == -1) {
+                reuseIndex = probedIndex;
+                reuseStep = i;
+            }
+        }
+        else if (ht->table[probedIndex].key == key) {
             ht->table[probedIndex].value = value;
-            cout << "  Updated '" << key << "' at index " << probedIndex << endl;
+            if (Log::enabled)
+                cout << "  Updated '" << key << "' at index " << probedIndex << endl;
             return;
         }
         
         i++;
     }
     
-    cout << "Error: Could not insert" << endl;
+    if (ht->size >= ht->capacity) {
+        if (Log::enabled)
+            cout << "Error: Hash table is full!" << endl;
+        return;
+    }
+    
+    // Prefer the tombstone (shorter probe path), otherwise the EMPTY cell
+    if (reuseIndex == -1 && i < ht->capacity) {
+        reuseIndex = quadraticProbe(index, i, ht->capacity);
+        reuseStep = i;
+    }
+    if (reuseIndex == -1) {
+        if (Log::enabled)
+            cout << "Error: Could not insert" << endl;
+        return;
+    }
+    
+    if (ht->table[reuseIndex].status == DELETED) {
+        ht->tombstones--;
+    }
+    ht->table[reuseIndex].key = key;
+    ht->table[reuseIndex].value = value;
+    ht->table[reuseIndex].status = OCCUPIED;
+    ht->table[reuseIndex].probeDist = reuseStep;
+    ht->size++;
+    
+    if (Log::enabled) {
+        cout << "  Inserted '" << key << "' at index " << reuseIndex;
+        if (reuseStep > 0) {
+            cout << " (after " << reuseStep << " probes, sequence: ";
+            for (int j = 0; j <= reuseStep; j++) {
+                cout << (index + j * j) % ht->capacity;
+                if (j < reuseStep) cout << "→";
+            }
+            cout << ")";
+        }
+        cout << endl;
+    }
 }
 
 /*
 SEARCH WITH QUADRATIC PROBING
 ------------------------------
 */
+// Slot index of key (or -1), starting from a precomputed home index.
+// Shared by quadraticSearch and quadraticLookupBatch, so both show up in
+// the probe statistics.
+template <typename K, typename V>
+int quadraticFindFrom(QuadraticProbingHashTable<K, V>* ht, const K& key, int home) {
+    ht->searches++;
+    for (int i = 0; i < ht->capacity; i++) {
+        int probedIndex = quadraticProbe(home, i, ht->capacity);
+        const HashEntry<K, V>& entry = ht->table[probedIndex];
+        ht->searchProbes++;
+        
+        if (entry.status == EMPTY) {
+            return -1;
+        }
+        if (entry.status == OCCUPIED && entry.key == key) {
+            return probedIndex;
+        }
+    }
+    return -1;
+}
+
 template <typename K, typename V>
 bool quadraticSearch(QuadraticProbingHashTable<K, V>* ht, K key, V* result) {
+    int slot = quadraticFindFrom(ht, key, hashFunction(key, ht->capacity));
+    if (slot == -1) {
+        return false;
+    }
+    *result = ht->table[slot].value;
+    return true;
+}
+
+/*
+DELETE WITH QUADRATIC PROBING
+------------------------------
+*/
+template <typename Log = DefaultLog, typename K, typename V>
+bool quadraticDelete(QuadraticProbingHashTable<K, V>* ht, K key) {
     int index = hashFunction(key, ht->capacity);
     int i = 0;
     
     while (i < ht->capacity) {
-        int probedIndex = (index + i * i) % ht->capacity;
+        int probedIndex = quadraticProbe(index, i, ht->capacity);
         
         if (ht->table[probedIndex].status == EMPTY) {
             return false;
@@ -499,7 +1092,16 @@ bool quadraticSearch(QuadraticProbingHashTable<K, V>* ht, K key, V* result) {
         
         if (ht->table[probedIndex].status == OCCUPIED && 
             ht->table[probedIndex].key == key) {
-            *result = ht->table[probedIndex].value;
+            
+            ht->table[probedIndex].status = DELETED;
+            ht->size--;
+            ht->tombstones++;
+            if (Log::enabled)
+                cout << "  Deleted '" << key << "' from index " << probedIndex << endl;
+            
+            if (ht->tombstones > ht->maxTombstoneFraction * ht->capacity) {
+                quadraticCompact(ht);
+            }
             return true;
         }
         
@@ -510,34 +1112,29 @@ bool quadraticSearch(QuadraticProbingHashTable<K, V>* ht, K key, V* result) {
 }
 
 /*
-DELETE WITH QUADRATIC PROBING
-------------------------------
+STATISTICS
+----------
+Live entries, tombstones and the average number of cells each search
+examined since the last resetQuadraticStats().
 */
 template <typename K, typename V>
-bool quadraticDelete(QuadraticProbingHashTable<K, V>* ht, K key) {
-    int index = hashFunction(key, ht->capacity);
-    int i = 0;
-    
-    while (i < ht->capacity) {
-        int probedIndex = (index + i * i) % ht->capacity;
-        
-        if (ht->table[probedIndex].status == EMPTY) {
-            return false;
-        }
-        
-        if (ht->table[probedIndex].status == OCCUPIED && 
-            ht->table[probedIndex].key == key) {
-            
-            ht->table[probedIndex].status = DELETED;
-            ht->size--;
-            cout << "  Deleted '" << key << "' from index " << probedIndex << endl;
-            return true;
-        }
-        
-        i++;
-    }
-    
-    return false;
+double averageSearchProbes(QuadraticProbingHashTable<K, V>* ht) {
+    return ht->searches ? (double)ht->searchProbes / ht->searches : 0.0;
+}
+
+template <typename K, typename V>
+void resetQuadraticStats(QuadraticProbingHashTable<K, V>* ht) {
+    ht->searches = 0;
+    ht->searchProbes = 0;
+}
+
+template <typename K, typename V>
+void quadraticStats(QuadraticProbingHashTable<K, V>* ht) {
+    cout << "  Live: " << ht->size
+         << " | Tombstones: " << ht->tombstones
+         << " | Empty: " << ht->capacity - ht->size - ht->tombstones
+         << " | Avg probes/search: " << averageSearchProbes(ht)
+         << " | Rebuilds: " << ht->rebuilds << endl;
 }
 
 /*
@@ -564,7 +1161,621 @@ void displayQuadratic(QuadraticProbingHashTable<K, V>* ht) {
                  << ht->table[i].value << "\n";
         }
     }
-    cout << "Size: " << ht->size << "/" << ht->capacity << endl;
+    cout << "Size: " << ht->size << "/" << ht->capacity
+         << "  Tombstones: " << ht->tombstones << endl;
+}
+
+//==============================================================================
+// SWISS TABLE (SIMD GROUP PROBING)
+//==============================================================================
+
+/*
+WHY ANOTHER LAYOUT?
+-------------------
+HashEntry<K, V> keeps key, value and a 4-byte CellStatus side by side:
+
+    table → [key|value|status][key|value|status][key|value|status]...
+
+Each probe step loads a whole entry (for string keys that is ~70 bytes,
+more than one cache line) just to look at its status and compare keys.
+
+SWISS TABLE LAYOUT:
+    ctrl   → [c0][c1][c2]...[c15][c16]...   1 byte per slot
+    keys   → [k0][k1][k2]...                 only touched on a tag match
+    values → [v0][v1][v2]...                 only touched on a hit
+
+Each control byte holds the CellStatus AND 7 bits of the key's hash:
+
+    EMPTY    = 1000 0000
+    DELETED  = 1111 1110
+    OCCUPIED = 0hhh hhhh   (h = low 7 bits of the hash, the "tag")
+
+Slots are grouped 16 at a time. One SSE2 instruction compares all 16
+control bytes of a group against the tag we are looking for:
+
+    ctrl group: [12][80][5A][12][FE][33]...   (hex)
+    tag 0x12  : [12][12][12][12][12][12]...
+    match bits:  1   0   0   1   0   0 ...
+
+Only slots whose tag matches (1 in 128 false-positive rate) have their key
+compared, so a typical lookup reads one 16-byte control group plus one key.
+
+PROBING:
+    hash → (group index = upper bits, tag = lower 7 bits)
+    Visit groups g, g+1, g+3, g+6, ... (triangular steps; with a power-of-two
+    number of groups this visits every group exactly once).
+    A search stops at the first group that contains an EMPTY slot.
+
+The table grows (doubles) when live + deleted slots pass 7/8 of capacity.
+The group width is 16 (one SSE2 register); without SSE2 a plain loop does
+the same byte compares.
+*/
+
+const int GROUP_WIDTH = 16;
+const signed char CTRL_EMPTY = -128;   // 1000 0000
+const signed char CTRL_DELETED = -2;   // 1111 1110
+
+template <typename K, typename V>
+struct SwissHashTable {
+    signed char* ctrl;   // One control byte per slot
+    K* keys;             // Keys stored out of line
+    V* values;           // Values stored out of line
+    int capacity;        // Power of two, multiple of GROUP_WIDTH
+    int size;            // OCCUPIED slots
+    int tombstones;      // DELETED slots
+    
+    SwissHashTable(int cap = GROUP_WIDTH) {
+        capacity = GROUP_WIDTH;
+        while (capacity < cap) capacity *= 2;
+        ctrl = new signed char[capacity];
+        keys = new K[capacity];
+        values = new V[capacity];
+        for (int i = 0; i < capacity; i++) ctrl[i] = CTRL_EMPTY;
+        size = 0;
+        tombstones = 0;
+    }
+    
+    ~SwissHashTable() {
+        delete[] ctrl;
+        delete[] keys;
+        delete[] values;
+    }
+};
+
+// Full-width hash; the table splits it into group index and 7-bit tag
+template <typename K>
+unsigned long long swissHash(const K& key) {
+    return Hasher<K>()(key);
+}
+
+// Bit i set ⇔ group[i] == tag
+inline unsigned matchTag(const signed char* group, signed char tag) {
+#ifdef __SSE2__
+    __m128i ctrlBytes = _mm_loadu_si128((const __m128i*)group);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrlBytes, _mm_set1_epi8(tag)));
+#else
+    unsigned mask = 0;
+    for (int i = 0; i < GROUP_WIDTH; i++) {
+        if (group[i] == tag) mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+// Bit i set ⇔ group[i] is EMPTY or DELETED (both have the top bit set)
+inline unsigned matchFree(const signed char* group) {
+#ifdef __SSE2__
+    return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    unsigned mask = 0;
+    for (int i = 0; i < GROUP_WIDTH; i++) {
+        if (group[i] < 0) mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+// Index of the lowest set bit (mask must not be 0)
+inline int lowestBit(unsigned mask) {
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    int i = 0;
+    while (!(mask & 1u)) { mask >>= 1; i++; }
+    return i;
+#endif
+}
+
+/*
+FIND SLOT
+---------
+Returns the slot index of key, or -1 if it is not in the table.
+*/
+template <typename K, typename V>
+int swissFind(SwissHashTable<K, V>* ht, const K& key) {
+    unsigned long long h = swissHash(key);
+    signed char tag = (signed char)(h & 0x7F);
+    int groupMask = ht->capacity / GROUP_WIDTH - 1;
+    int group = (int)(h >> 7) & groupMask;
+    
+    for (int step = 1; step <= groupMask + 1; step++) {
+        const signed char* ctrlGroup = ht->ctrl + group * GROUP_WIDTH;
+        
+        unsigned candidates = matchTag(ctrlGroup, tag);
+        while (candidates) {
+            int slot = group * GROUP_WIDTH + lowestBit(candidates);
+            if (ht->keys[slot] == key) {
+                return slot;
+            }
+            candidates &= candidates - 1;  // Clear lowest bit
+        }
+        
+        if (matchTag(ctrlGroup, CTRL_EMPTY)) {
+            return -1;  // An EMPTY slot ends every probe sequence
+        }
+        group = (group + step) & groupMask;
+    }
+    
+    return -1;
+}
+
+// Place a key known to be absent into the first EMPTY/DELETED slot
+template <typename K, typename V>
+void swissPlace(SwissHashTable<K, V>* ht, const K& key, const V& value) {
+    unsigned long long h = swissHash(key);
+    int groupMask = ht->capacity / GROUP_WIDTH - 1;
+    int group = (int)(h >> 7) & groupMask;
+    
+    for (int step = 1; ; step++) {
+        unsigned freeSlots = matchFree(ht->ctrl + group * GROUP_WIDTH);
+        if (freeSlots) {
+            int slot = group * GROUP_WIDTH + lowestBit(freeSlots);
+            if (ht->ctrl[slot] == CTRL_DELETED) {
+                ht->tombstones--;
+            }
+            ht->ctrl[slot] = (signed char)(h & 0x7F);
+            ht->keys[slot] = key;
+            ht->values[slot] = value;
+            ht->size++;
+            return;
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+/*
+REHASH
+------
+Move every OCCUPIED slot into fresh arrays. If most of the used slots are
+tombstones we keep the capacity, otherwise it doubles.
+*/
+template <typename K, typename V>
+void swissRehash(SwissHashTable<K, V>* ht) {
+    int oldCapacity = ht->capacity;
+    signed char* oldCtrl = ht->ctrl;
+    K* oldKeys = ht->keys;
+    V* oldValues = ht->values;
+    
+    if (ht->size * 2 >= oldCapacity * 7 / 8) {
+        ht->capacity *= 2;
+    }
+    ht->ctrl = new signed char[ht->capacity];
+    ht->keys = new K[ht->capacity];
+    ht->values = new V[ht->capacity];
+    for (int i = 0; i < ht->capacity; i++) ht->ctrl[i] = CTRL_EMPTY;
+    ht->size = 0;
+    ht->tombstones = 0;
+    
+    for (int i = 0; i < oldCapacity; i++) {
+        if (oldCtrl[i] >= 0) {
+            swissPlace(ht, oldKeys[i], oldValues[i]);
+        }
+    }
+    
+    delete[] oldCtrl;
+    delete[] oldKeys;
+    delete[] oldValues;
+}
+
+/*
+INSERT / SEARCH / DELETE
+------------------------
+Same calling convention as linearInsert / linearSearch / linearDelete.
+*/
+template <typename K, typename V>
+void swissInsert(SwissHashTable<K, V>* ht, K key, V value) {
+    int slot = swissFind(ht, key);
+    if (slot != -1) {
+        ht->values[slot] = value;  // Update existing key
+        return;
+    }
+    
+    // Keep at least 1/8 of the slots EMPTY so probe sequences stay short
+    if ((ht->size + ht->tombstones + 1) * 8 > ht->capacity * 7) {
+        swissRehash(ht);
+    }
+    swissPlace(ht, key, value);
+}
+
+template <typename K, typename V>
+bool swissSearch(SwissHashTable<K, V>* ht, K key, V* result) {
+    int slot = swissFind(ht, key);
+    if (slot == -1) {
+        return false;
+    }
+    *result = ht->values[slot];
+    return true;
+}
+
+/*
+If the slot's group still has an EMPTY slot, no probe sequence ever went
+past this group, so the slot can go straight back to EMPTY. Otherwise a
+later key may have probed through here and we need a DELETED marker.
+*/
+template <typename K, typename V>
+bool swissDelete(SwissHashTable<K, V>* ht, K key) {
+    int slot = swissFind(ht, key);
+    if (slot == -1) {
+        return false;
+    }
+    
+    const signed char* ctrlGroup = ht->ctrl + (slot / GROUP_WIDTH) * GROUP_WIDTH;
+    if (matchTag(ctrlGroup, CTRL_EMPTY)) {
+        ht->ctrl[slot] = CTRL_EMPTY;
+    } else {
+        ht->ctrl[slot] = CTRL_DELETED;
+        ht->tombstones++;
+    }
+    ht->size--;
+    return true;
+}
+
+template <typename K, typename V>
+void displaySwiss(SwissHashTable<K, V>* ht) {
+    cout << "\nHash Table Contents (Swiss Table):\n";
+    cout << "Index | Ctrl      | Key       | Value\n";
+    cout << "------|-----------|-----------|----------\n";
+    
+    for (int i = 0; i < ht->capacity; i++) {
+        cout << "  " << i << (i < 10 ? "   | " : "  | ");
+        
+        if (ht->ctrl[i] == CTRL_EMPTY) {
+            cout << "EMPTY     | -         | -\n";
+        }
+        else if (ht->ctrl[i] == CTRL_DELETED) {
+            cout << "DELETED   | -         | -\n";
+        }
+        else {
+            cout << "tag " << (int)ht->ctrl[i] << (ht->ctrl[i] < 10 ? "     | " : 
+                    ht->ctrl[i] < 100 ? "    | " : "   | ")
+                 << ht->keys[i] << " | " << ht->values[i] << "\n";
+        }
+    }
+    cout << "Size: " << ht->size << "/" << ht->capacity
+         << "  Tombstones: " << ht->tombstones << endl;
+}
+
+//==============================================================================
+// HELPERS
+//==============================================================================
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+//==============================================================================
+// CONCURRENT SHARDED HASH TABLE
+//==============================================================================
+
+/*
+SHARING A TABLE BETWEEN THREADS
+-------------------------------
+Two threads calling robinHoodInsert() on the same table at the same time
+can both pick the same EMPTY slot, or one can read an entry while the
+other is half-way through moving it. We need locking.
+
+One lock for the whole table works, but then only one thread can do
+anything at a time. Instead we split the keys over many independent
+LinearProbingHashTables ("shards"), each with its own lock:
+
+    hash(key) → low bits pick the shard, high bits pick the slot
+
+    shard 0: [lock][LinearProbingHashTable]
+    shard 1: [lock][LinearProbingHashTable]
+    ...
+    shard 63: [lock][LinearProbingHashTable]
+
+Threads working on different shards never wait for each other. Each lock
+is a reader-writer lock (shared_mutex): any number of searches can run in
+the same shard at once, inserts and deletes get it exclusively.
+
+Each shard sits on its own 64-byte cache line so locking shard 3 does not
+slow down a thread using shard 4 (no "false sharing").
+
+Shards use the Robin Hood functions and do not grow: pass the expected
+number of keys to the constructor. concurrentInsert() returns false if a
+shard is full.
+*/
+
+template <typename K, typename V>
+struct alignas(64) Shard {
+    shared_mutex lock;
+    LinearProbingHashTable<K, V>* table;
+    
+    Shard() : table(nullptr) {}
+    ~Shard() { delete table; }
+};
+
+template <typename K, typename V>
+struct ConcurrentHashTable {
+    Shard<K, V>* shards;
+    int shardCount;   // Power of two
+    
+    ConcurrentHashTable(int expectedKeys, int shards_ = 64) {
+        shardCount = 1;
+        while (shardCount < shards_) shardCount *= 2;
+        shards = new Shard<K, V>[shardCount];
+        
+        // Keep each shard below 0.8 load
+        int perShard = nextPrime(expectedKeys / shardCount * 5 / 4 + 16);
+        for (int i = 0; i < shardCount; i++) {
+            shards[i].table = new LinearProbingHashTable<K, V>(perShard);
+        }
+    }
+    
+    ~ConcurrentHashTable() {
+        delete[] shards;
+    }
+};
+
+template <typename K, typename V>
+Shard<K, V>& shardFor(ConcurrentHashTable<K, V>* ht, const K& key) {
+    return ht->shards[Hasher<K>()(key) & (unsigned long long)(ht->shardCount - 1)];
+}
+
+template <typename K, typename V>
+bool concurrentInsert(ConcurrentHashTable<K, V>* ht, K key, V value) {
+    Shard<K, V>& shard = shardFor(ht, key);
+    unique_lock<shared_mutex> guard(shard.lock);  // Exclusive
+    return robinHoodInsert(shard.table, key, value);
+}
+
+template <typename K, typename V>
+bool concurrentSearch(ConcurrentHashTable<K, V>* ht, K key, V* result) {
+    Shard<K, V>& shard = shardFor(ht, key);
+    shared_lock<shared_mutex> guard(shard.lock);  // Shared with other readers
+    return robinHoodSearch(shard.table, key, result);
+}
+
+template <typename K, typename V>
+bool concurrentDelete(ConcurrentHashTable<K, V>* ht, K key) {
+    Shard<K, V>& shard = shardFor(ht, key);
+    unique_lock<shared_mutex> guard(shard.lock);
+    return robinHoodDelete(shard.table, key);
+}
+
+template <typename K, typename V>
+int concurrentSize(ConcurrentHashTable<K, V>* ht) {
+    int total = 0;
+    for (int i = 0; i < ht->shardCount; i++) {
+        shared_lock<shared_mutex> guard(ht->shards[i].lock);
+        total += ht->shards[i].table->size;
+    }
+    return total;
+}
+
+//==============================================================================
+// BULK (BATCH) INSERT AND LOOKUP
+//==============================================================================
+
+/*
+WHY BATCH?
+----------
+On a table much bigger than the CPU cache, almost every probe is a cache
+miss: the CPU waits ~100 ns for the entry to arrive from RAM. Calling
+linearSearch() once per key means waiting for those misses one after
+another:
+
+    key0: hash → [wait for RAM] → compare
+    key1:                                  hash → [wait for RAM] → compare
+
+A batch call works on a block of 16 keys at a time:
+    1. hash all 16 keys
+    2. prefetch all 16 home slots (ask RAM for them, don't wait)
+    3. resolve the probes - by now most slots have arrived
+
+    key0..15: hash hash hash ... → prefetch ×16 → [one overlapped wait] → compare ×16
+
+The batch functions return a result per key and never print.
+*/
+
+const int BATCH_BLOCK = 16;
+
+enum BatchResult {
+    BATCH_INSERTED,   // New key stored
+    BATCH_UPDATED,    // Key existed, value replaced
+    BATCH_FAILED      // No free cell for it
+};
+
+// Hint the CPU to start loading an address into cache
+inline void prefetch(const void* address) {
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+// Step 1 and 2 of a batch: home slot of each key in the block, prefetched
+template <typename Table, typename K>
+void hashAndPrefetch(Table* ht, const K* keys, int n, int* home) {
+    for (int i = 0; i < n; i++) {
+        home[i] = hashFunction(keys[i], ht->capacity);
+        prefetch(&ht->table[home[i]]);
+    }
+}
+
+/*
+Linear probing insert starting from a precomputed home index.
+Like quadraticInsert, it probes past DELETED cells to EMPTY before reusing
+the first one, so a key is never stored twice.
+*/
+template <typename K, typename V>
+BatchResult linearInsertFrom(LinearProbingHashTable<K, V>* ht, const K& key,
+                             const V& value, int home) {
+    int reuseIndex = -1, reuseStep = 0;
+    int i = 0;
+    for (; i < ht->capacity; i++) {
+        int probedIndex = home + i < ht->capacity ? home + i : home + i - ht->capacity;
+        HashEntry<K, V>& entry = ht->table[probedIndex];
+        
+        if (entry.status == EMPTY) {
+            if (reuseIndex == -1) {
+                reuseIndex = probedIndex;
+                reuseStep = i;
+            }
+            break;
+        }
+        if (entry.status == DELETED) {
+            if (reuseIndex == -1) {
+                reuseIndex = probedIndex;
+                reuseStep = i;
+            }
+        }
+        else if (entry.key == key) {
+            entry.value = value;
+            return BATCH_UPDATED;
+        }
+    }
+    
+    if (reuseIndex == -1) {
+        return BATCH_FAILED;
+    }
+    HashEntry<K, V>& entry = ht->table[reuseIndex];
+    entry.key = key;
+    entry.value = value;
+    entry.status = OCCUPIED;
+    entry.probeDist = reuseStep;
+    ht->size++;
+    return BATCH_INSERTED;
+}
+
+/*
+INSERT BATCH - results[i] tells what happened to keys[i]
+block = keys hashed and prefetched together (1 = no overlap)
+*/
+template <typename K, typename V>
+void linearInsertBatch(LinearProbingHashTable<K, V>* ht, const K* keys, const V* values,
+                       int count, BatchResult* results, int block = BATCH_BLOCK) {
+    int home[BATCH_BLOCK];
+    block = max(1, min(block, BATCH_BLOCK));
+    
+    for (int base = 0; base < count; base += block) {
+        int n = min(block, count - base);
+        hashAndPrefetch(ht, keys + base, n, home);
+        for (int i = 0; i < n; i++) {
+            results[base + i] = linearInsertFrom(ht, keys[base + i], values[base + i], home[i]);
+        }
+    }
+}
+
+/*
+LOOKUP BATCH - found[i] tells whether keys[i] exists; if so values[i] is set
+*/
+template <typename K, typename V>
+void linearLookupBatch(LinearProbingHashTable<K, V>* ht, const K* keys, int count,
+                       V* values, bool* found, int block = BATCH_BLOCK) {
+    int home[BATCH_BLOCK];
+    block = max(1, min(block, BATCH_BLOCK));
+    
+    for (int base = 0; base < count; base += block) {
+        int n = min(block, count - base);
+        hashAndPrefetch(ht, keys + base, n, home);
+        for (int i = 0; i < n; i++) {
+            int slot = linearFindFrom(ht, keys[base + i], home[i]);
+            found[base + i] = slot != -1;
+            if (slot != -1) {
+                values[base + i] = ht->table[slot].value;
+            }
+        }
+    }
+}
+
+// Quadratic versions: same idea, (home + i²) probe sequence
+template <typename K, typename V>
+BatchResult quadraticInsertFrom(QuadraticProbingHashTable<K, V>* ht, const K& key,
+                                const V& value, int home) {
+    int reuseIndex = -1, reuseStep = 0;
+    for (int i = 0; i < ht->capacity; i++) {
+        int probedIndex = quadraticProbe(home, i, ht->capacity);
+        HashEntry<K, V>& entry = ht->table[probedIndex];
+        
+        if (entry.status == EMPTY) {
+            if (reuseIndex == -1) {
+                reuseIndex = probedIndex;
+                reuseStep = i;
+            }
+            break;
+        }
+        if (entry.status == DELETED) {
+            if (reuseIndex == -1) {
+                reuseIndex = probedIndex;
+                reuseStep = i;
+            }
+        }
+        else if (entry.key == key) {
+            entry.value = value;
+            return BATCH_UPDATED;
+        }
+    }
+    
+    if (reuseIndex == -1) {
+        return BATCH_FAILED;
+    }
+    HashEntry<K, V>& entry = ht->table[reuseIndex];
+    if (entry.status == DELETED) {
+        ht->tombstones--;
+    }
+    entry.key = key;
+    entry.value = value;
+    entry.status = OCCUPIED;
+    entry.probeDist = reuseStep;
+    ht->size++;
+    return BATCH_INSERTED;
+}
+
+template <typename K, typename V>
+void quadraticInsertBatch(QuadraticProbingHashTable<K, V>* ht, const K* keys, const V* values,
+                          int count, BatchResult* results, int block = BATCH_BLOCK) {
+    int home[BATCH_BLOCK];
+    block = max(1, min(block, BATCH_BLOCK));
+    
+    for (int base = 0; base < count; base += block) {
+        int n = min(block, count - base);
+        hashAndPrefetch(ht, keys + base, n, home);
+        for (int i = 0; i < n; i++) {
+            results[base + i] = quadraticInsertFrom(ht, keys[base + i], values[base + i], home[i]);
+        }
+    }
+}
+
+template <typename K, typename V>
+void quadraticLookupBatch(QuadraticProbingHashTable<K, V>* ht, const K* keys, int count,
+                          V* values, bool* found, int block = BATCH_BLOCK) {
+    int home[BATCH_BLOCK];
+    block = max(1, min(block, BATCH_BLOCK));
+    
+    for (int base = 0; base < count; base += block) {
+        int n = min(block, count - base);
+        hashAndPrefetch(ht, keys + base, n, home);
+        for (int i = 0; i < n; i++) {
+            int slot = quadraticFindFrom(ht, keys[base + i], home[i]);
+            found[base + i] = slot != -1;
+            if (slot != -1) {
+                values[base + i] = ht->table[slot].value;
+            }
+        }
+    }
 }
 
 //==============================================================================
@@ -579,11 +1790,11 @@ void demonstrateLinearProbing() {
     LinearProbingHashTable<string, int> ht(11);
     
     cout << "Inserting key-value pairs:\n";
-    linearInsert(&ht, string("Alice"), 25);
-    linearInsert(&ht, string("Bob"), 30);
-    linearInsert(&ht, string("Charlie"), 35);
-    linearInsert(&ht, string("Diana"), 28);
-    linearInsert(&ht, string("Eve"), 32);
+    linearInsert<VerboseLog>(&ht, string("Alice"), 25);
+    linearInsert<VerboseLog>(&ht, string("Bob"), 30);
+    linearInsert<VerboseLog>(&ht, string("Charlie"), 35);
+    linearInsert<VerboseLog>(&ht, string("Diana"), 28);
+    linearInsert<VerboseLog>(&ht, string("Eve"), 32);
     
     displayLinear(&ht);
     
@@ -600,12 +1811,12 @@ void demonstrateLinearProbing() {
     
     // Delete
     cout << "\nDeleting Bob:\n";
-    linearDelete(&ht, string("Bob"));
+    linearDelete<VerboseLog>(&ht, string("Bob"));
     displayLinear(&ht);
     
     // Insert after delete
     cout << "\nInserting Frank (will use deleted spot):\n";
-    linearInsert(&ht, string("Frank"), 27);
+    linearInsert<VerboseLog>(&ht, string("Frank"), 27);
     displayLinear(&ht);
 }
 
@@ -617,11 +1828,11 @@ void demonstrateQuadraticProbing() {
     QuadraticProbingHashTable<string, int> ht(11);
     
     cout << "Inserting key-value pairs:\n";
-    quadraticInsert(&ht, string("Alice"), 25);
-    quadraticInsert(&ht, string("Bob"), 30);
-    quadraticInsert(&ht, string("Charlie"), 35);
-    quadraticInsert(&ht, string("Diana"), 28);
-    quadraticInsert(&ht, string("Eve"), 32);
+    quadraticInsert<VerboseLog>(&ht, string("Alice"), 25);
+    quadraticInsert<VerboseLog>(&ht, string("Bob"), 30);
+    quadraticInsert<VerboseLog>(&ht, string("Charlie"), 35);
+    quadraticInsert<VerboseLog>(&ht, string("Diana"), 28);
+    quadraticInsert<VerboseLog>(&ht, string("Eve"), 32);
     
     displayQuadratic(&ht);
     
@@ -634,12 +1845,12 @@ void demonstrateQuadraticProbing() {
     
     // Delete
     cout << "\nDeleting Charlie:\n";
-    quadraticDelete(&ht, string("Charlie"));
+    quadraticDelete<VerboseLog>(&ht, string("Charlie"));
     displayQuadratic(&ht);
     
     // Insert after delete
     cout << "\nInserting George:\n";
-    quadraticInsert(&ht, string("George"), 29);
+    quadraticInsert<VerboseLog>(&ht, string("George"), 29);
     displayQuadratic(&ht);
 }
 
@@ -657,8 +1868,8 @@ void compareProbing() {
     int values[] = {25, 30, 35, 28, 32, 27};
     
     for (int i = 0; i < 6; i++) {
-        linearInsert(&linear, keys[i], values[i]);
-        quadraticInsert(&quadratic, keys[i], values[i]);
+        linearInsert<VerboseLog>(&linear, keys[i], values[i]);
+        quadraticInsert<VerboseLog>(&quadratic, keys[i], values[i]);
     }
     
     displayLinear(&linear);
@@ -669,11 +1880,526 @@ void compareProbing() {
     cout << "Quadratic: Better distribution (less clustering)\n";
 }
 
+/*
+Delete/insert churn: keep ~40% of the table live while constantly
+replacing keys, then measure search cost for keys that are NOT present
+(those walk until an EMPTY cell, so they suffer most from tombstones).
+*/
+void churnQuadratic(QuadraticProbingHashTable<string, int>* ht, int live, int rounds) {
+    for (int i = 0; i < live; i++) {
+        quadraticInsert(ht, "key" + to_string(i), i);
+    }
+    for (int r = 0; r < rounds; r++) {
+        quadraticDelete(ht, "key" + to_string(r));
+        quadraticInsert(ht, "key" + to_string(r + live), r);
+    }
+    
+    resetQuadraticStats(ht);
+    int value;
+    for (int i = 0; i < 2000; i++) {
+        quadraticSearch(ht, "missing" + to_string(i), &value);
+    }
+}
+
+void demonstrateTombstoneCompaction() {
+    cout << "\n====================================================\n";
+    cout << "  QUADRATIC PROBING: TOMBSTONES VS COMPACTION\n";
+    cout << "====================================================\n\n";
+    
+    const int capacity = 1009;  // prime
+    const int live = 400;
+    const int rounds = 20000;
+    
+    cout << rounds << " delete+insert rounds, " << live << " live keys, capacity "
+         << capacity << "\n";
+    cout << "Stats below are for 2000 searches of missing keys.\n\n";
+    
+    QuadraticProbingHashTable<string, int> noCompaction(capacity, 1.0);
+    churnQuadratic(&noCompaction, live, rounds);
+    cout << "Without compaction:\n";
+    quadraticStats(&noCompaction);
+    
+    QuadraticProbingHashTable<string, int> compacted(capacity);
+    churnQuadratic(&compacted, live, rounds);
+    cout << "\nWith compaction (rebuild above "
+         << MAX_TOMBSTONE_FRACTION * 100 << "% tombstones):\n";
+    quadraticStats(&compacted);
+}
+
+void demonstrateRobinHood() {
+    cout << "\n====================================================\n";
+    cout << "  ROBIN HOOD PROBING DEMONSTRATION\n";
+    cout << "====================================================\n\n";
+    
+    LinearProbingHashTable<string, int> ht(11);
+    
+    string keys[] = {"Alice", "Bob", "Charlie", "Diana", "Eve", "Frank"};
+    int values[] = {25, 30, 35, 28, 32, 27};
+    
+    cout << "Inserting key-value pairs:\n";
+    for (int i = 0; i < 6; i++) {
+        robinHoodInsert(&ht, keys[i], values[i]);
+        int index = robinHoodFind(&ht, keys[i]);
+        cout << "  '" << keys[i] << "' home " << hashFunction(keys[i], ht.capacity)
+             << " → index " << index << " (dist " << ht.table[index].probeDist << ")\n";
+    }
+    displayLinear(&ht);
+    
+    cout << "\nDeleting Bob (backward shift, no DELETED cell):\n";
+    robinHoodDelete(&ht, string("Bob"));
+    displayLinear(&ht);
+    
+    int value;
+    if (robinHoodSearch(&ht, string("Frank"), &value)) {
+        cout << "\n  Found Frank: " << value << endl;
+    }
+    if (!robinHoodSearch(&ht, string("Bob"), &value)) {
+        cout << "  Bob not found" << endl;
+    }
+}
+
+/*
+Fill two tables to 90% load with the same key set ("user1000",
+"user1001", ...) and compare how far entries end up from home.
+*/
+void compareRobinHood() {
+    cout << "\n====================================================\n";
+    cout << "  LINEAR VS ROBIN HOOD: PROBE LENGTHS AT 0.9 LOAD\n";
+    cout << "====================================================\n";
+    
+    const int capacity = 10007;  // prime
+    const int count = capacity * 9 / 10;
+    
+    LinearProbingHashTable<string, int> linear(capacity);
+    LinearProbingHashTable<string, int> robin(capacity);
+    
+    for (int i = 0; i < count; i++) {
+        string key = "user" + to_string(1000 + i);
+        linearInsert(&linear, key, i);
+        robinHoodInsert(&robin, key, i);
+    }
+    
+    probeHistogram(&linear, "Linear probing");
+    probeHistogram(&robin, "Robin Hood probing");
+    
+    cout << "\nSame average distance, but Robin Hood removes the long tail:\n";
+    cout << "no key is left far away from home, so the worst-case lookup is short.\n";
+}
+
+void demonstrateSwissTable() {
+    cout << "\n====================================================\n";
+    cout << "  SWISS TABLE DEMONSTRATION\n";
+    cout << "====================================================\n";
+    
+    SwissHashTable<string, int> ht;
+    
+    string keys[] = {"Alice", "Bob", "Charlie", "Diana", "Eve", "Frank"};
+    int values[] = {25, 30, 35, 28, 32, 27};
+    for (int i = 0; i < 6; i++) {
+        swissInsert(&ht, keys[i], values[i]);
+    }
+    displaySwiss(&ht);
+    
+    cout << "\nSearching:\n";
+    int value;
+    if (swissSearch(&ht, string("Charlie"), &value)) {
+        cout << "  Found Charlie: " << value << endl;
+    }
+    if (!swissSearch(&ht, string("George"), &value)) {
+        cout << "  George not found" << endl;
+    }
+    
+    cout << "\nDeleting Bob, inserting 20 more keys (table grows to 32):\n";
+    swissDelete(&ht, string("Bob"));
+    for (int i = 0; i < 20; i++) {
+        swissInsert(&ht, "guest" + to_string(i), i);
+    }
+    cout << "  Size: " << ht.size << "/" << ht.capacity << endl;
+    cout << "  Bob present? " << (swissSearch(&ht, string("Bob"), &value) ? "yes" : "no") << endl;
+}
+
+//==============================================================================
+// BENCHMARKS  (./task4 bench)
+//==============================================================================
+
+/*
+Phone book: "First Last #id" → phone number, 500k entries.
+Both tables run at ~0.75 load with the same keys and lookups.
+*/
+void benchmarkSwissTable() {
+    cout << "\n====================================================\n";
+    cout << "  BENCHMARK: HashEntry LAYOUT VS SWISS TABLE\n";
+    cout << "====================================================\n";
+    
+    const int count = 500000;
+    const string first[] = {"Alice", "Bob", "Charlie", "Diana", "Eve", "Frank", "Grace", "Heidi"};
+    const string last[] = {"Smith", "Khan", "Garcia", "Chen", "Muller", "Rossi", "Ali", "Novak"};
+    
+    string* names = new string[count];
+    string* missing = new string[count];
+    for (int i = 0; i < count; i++) {
+        names[i] = first[i % 8] + " " + last[(i / 8) % 8] + " #" + to_string(i);
+        missing[i] = first[i % 8] + " " + last[(i / 8) % 8] + " ?" + to_string(i);
+    }
+    
+    LinearProbingHashTable<string, long long> linear(nextPrime(count * 4 / 3));
+    SwissHashTable<string, long long> swiss(count * 8 / 7 + 1);
+    
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) linearInsert(&linear, names[i], 5550000000LL + i);
+    double linearInsertTime = secondsSince(start);
+    
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) swissInsert(&swiss, names[i], 5550000000LL + i);
+    double swissInsertTime = secondsSince(start);
+    
+    long long phone, checksum = 0;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) if (linearSearch(&linear, names[i], &phone)) checksum += phone;
+    double linearHitTime = secondsSince(start);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) if (linearSearch(&linear, missing[i], &phone)) checksum += phone;
+    double linearMissTime = secondsSince(start);
+    
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) if (swissSearch(&swiss, names[i], &phone)) checksum -= phone;
+    double swissHitTime = secondsSince(start);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) if (swissSearch(&swiss, missing[i], &phone)) checksum -= phone;
+    double swissMissTime = secondsSince(start);
+    
+    cout << "\n" << count << " string keys (checksum " << checksum << ", expect 0)\n\n";
+    cout << "Table      | Inserts/sec | Hits/sec    | Misses/sec\n";
+    cout << "-----------|-------------|-------------|------------\n";
+    printf("Linear     | %11.0f | %11.0f | %11.0f\n",
+           count / linearInsertTime, count / linearHitTime, count / linearMissTime);
+    printf("Swiss      | %11.0f | %11.0f | %11.0f\n",
+           count / swissInsertTime, count / swissHitTime, count / swissMissTime);
+    
+    delete[] names;
+    delete[] missing;
+}
+
+// Hash results of the throughput loops end up here; the store cannot be skipped
+volatile unsigned long long hashSink = 0;
+
+/*
+Hash throughput in bytes/sec for different key lengths.
+The polynomial hash is reduced modulo a prime (10007) as the old tables did.
+*/
+void benchmarkHashFunctions() {
+    cout << "\n====================================================\n";
+    cout << "  BENCHMARK: STRING HASH THROUGHPUT\n";
+    cout << "====================================================\n\n";
+    
+    const int lengths[] = {8, 16, 32, 64, 256, 4096};
+    const long long bytesPerRun = 64LL * 1024 * 1024;
+    
+    cout << "Key bytes | Polynomial MB/s | hashBytes MB/s\n";
+    cout << "----------|-----------------|---------------\n";
+    
+    for (int len : lengths) {
+        // 64 different keys of this length, cycled through
+        string keys[64];
+        for (int k = 0; k < 64; k++) {
+            keys[k].resize(len);
+            for (int c = 0; c < len; c++) keys[k][c] = (char)('a' + (k * 7 + c * 13) % 26);
+        }
+        long long calls = bytesPerRun / len;
+        unsigned long long sink = 0;
+        
+        auto start = chrono::steady_clock::now();
+        for (long long i = 0; i < calls; i++) sink += hashStringPolynomial(keys[i & 63], 10007);
+        double polyTime = secondsSince(start);
+        
+        start = chrono::steady_clock::now();
+        for (long long i = 0; i < calls; i++) sink += hashString(keys[i & 63], 10007);
+        double fastTime = secondsSince(start);
+        
+        printf("%9d | %15.0f | %14.0f\n", len,
+               bytesPerRun / polyTime / 1e6, bytesPerRun / fastTime / 1e6);
+        hashSink = sink;  // A volatile store keeps the loops from being optimized away
+    }
+}
+
+/*
+Distribution of one key set over `buckets` buckets.
+chi² / (buckets - 1) should be close to 1.0 for a uniform hash; above ~1.5
+means keys are piling up in some buckets.
+*/
+double chiSquaredRatio(const string* keys, int count, int buckets, bool polynomial) {
+    int* counts = new int[buckets]();
+    for (int i = 0; i < count; i++) {
+        int index = polynomial ? hashStringPolynomial(keys[i], buckets)
+                               : (buckets & (buckets - 1)) == 0
+                                   ? reduceMask(Hasher<string>()(keys[i]), buckets - 1)
+                                   : hashString(keys[i], buckets);
+        counts[index]++;
+    }
+    double expected = (double)count / buckets;
+    double chi2 = 0;
+    for (int b = 0; b < buckets; b++) {
+        chi2 += (counts[b] - expected) * (counts[b] - expected) / expected;
+    }
+    delete[] counts;
+    return chi2 / (buckets - 1);
+}
+
+// Number of keys whose full 64-bit hash equals another key's hash
+int fullHashCollisions(const string* keys, int count) {
+    unsigned long long* hashes = new unsigned long long[count];
+    for (int i = 0; i < count; i++) hashes[i] = Hasher<string>()(keys[i]);
+    sort(hashes, hashes + count);
+    int collisions = 0;
+    for (int i = 1; i < count; i++) {
+        if (hashes[i] == hashes[i - 1]) collisions++;
+    }
+    delete[] hashes;
+    return collisions;
+}
+
+void testHashQuality() {
+    cout << "\n====================================================\n";
+    cout << "  HASH QUALITY ON REALISTIC KEY SETS\n";
+    cout << "====================================================\n\n";
+    
+    const int count = 200000;
+    const char* names[] = {"Sequential IDs", "Phone numbers", "Email addresses", "URL paths"};
+    string* keys = new string[count];
+    bool allGood = true;
+    
+    cout << "Key set         | Buckets | Polynomial χ²/df | hashBytes χ²/df | 64-bit collisions\n";
+    cout << "----------------|---------|------------------|-----------------|------------------\n";
+    
+    for (int set = 0; set < 4; set++) {
+        for (int i = 0; i < count; i++) {
+            string n = to_string(i);
+            switch (set) {
+                case 0: keys[i] = "user" + string(7 - n.length(), '0') + n; break;
+                case 1: keys[i] = "+1-555-" + string(7 - n.length(), '0') + n; break;
+                case 2: keys[i] = "student" + n + "@university.edu"; break;
+                default: keys[i] = "/api/v1/items/" + n + "/details?lang=en"; break;
+            }
+        }
+        int collisions = fullHashCollisions(keys, count);
+        
+        const int bucketCounts[] = {1009, 1024};  // Prime and power of two
+        for (int bucket : bucketCounts) {
+            double poly = chiSquaredRatio(keys, count, bucket, true);
+            double fast = chiSquaredRatio(keys, count, bucket, false);
+            printf("%-15s | %7d | %16.2f | %15.2f | %d\n",
+                   names[set], bucket, poly, fast, collisions);
+            if (fast > 1.5 || collisions > 0) allGood = false;
+        }
+    }
+    
+    cout << "\nhashBytes quality check: " << (allGood ? "PASS" : "FAIL")
+         << " (χ²/df ≤ 1.5 and no 64-bit collisions)\n";
+    delete[] keys;
+}
+
+void demonstrateConcurrentTable() {
+    cout << "\n====================================================\n";
+    cout << "  CONCURRENT SHARDED TABLE DEMONSTRATION\n";
+    cout << "====================================================\n\n";
+    
+    const int threads = 4;
+    const int perThread = 10000;
+    ConcurrentHashTable<int, int> ht(threads * perThread, 16);
+    
+    cout << threads << " threads each insert " << perThread << " different keys...\n";
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.push_back(thread([&ht, t]() {
+            for (int i = 0; i < perThread; i++) {
+                int key = t * perThread + i;
+                concurrentInsert(&ht, key, key * 2);
+            }
+        }));
+    }
+    for (thread& w : workers) w.join();
+    
+    int value;
+    cout << "  Total size: " << concurrentSize(&ht) << " (expected " << threads * perThread << ")\n";
+    if (concurrentSearch(&ht, 12345, &value)) {
+        cout << "  Found 12345 → " << value << endl;
+    }
+}
+
+// xorshift64 - cheap per-thread random numbers for the benchmarks
+unsigned long long nextRandom(unsigned long long* state) {
+    unsigned long long x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+/*
+Millions of operations per second for 1..64 threads.
+readPercent = share of operations that are searches; the rest alternate
+between insert and delete so the table size stays roughly constant.
+*/
+double runConcurrentMix(int threads, int shards, int readPercent, int keyRange, int totalOps) {
+    ConcurrentHashTable<int, int> ht(keyRange, shards);
+    for (int key = 0; key < keyRange; key += 2) {
+        concurrentInsert(&ht, key, key);
+    }
+    
+    int opsPerThread = totalOps / threads;
+    vector<thread> workers;
+    auto start = chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++) {
+        workers.push_back(thread([&ht, t, opsPerThread, readPercent, keyRange]() {
+            unsigned long long rng = 0x9E3779B97F4A7C15ULL * (t + 1);
+            int value;
+            for (int i = 0; i < opsPerThread; i++) {
+                unsigned long long r = nextRandom(&rng);
+                int key = (int)((r >> 8) % keyRange);
+                if ((int)(r % 100) < readPercent) {
+                    concurrentSearch(&ht, key, &value);
+                } else if (r & 128) {
+                    concurrentInsert(&ht, key, i);
+                } else {
+                    concurrentDelete(&ht, key);
+                }
+            }
+        }));
+    }
+    for (thread& w : workers) w.join();
+    double elapsed = secondsSince(start);
+    
+    return opsPerThread * (double)threads / elapsed / 1e6;
+}
+
+void benchmarkConcurrentTable() {
+    cout << "\n====================================================\n";
+    cout << "  BENCHMARK: SHARDED TABLE SCALING (Mops/sec)\n";
+    cout << "====================================================\n\n";
+    
+    const int keyRange = 1 << 20;
+    const int totalOps = 4000000;
+    const int threadCounts[] = {1, 2, 4, 8, 16, 32, 64};
+    
+    cout << "Hardware threads: " << thread::hardware_concurrency() << "\n";
+    cout << "1 shard = one lock for the whole table (baseline)\n\n";
+    cout << "Threads | 95% reads, 1 shard | 95% reads, 64 shards | 50% reads, 1 shard | 50% reads, 64 shards\n";
+    cout << "--------|--------------------|----------------------|--------------------|---------------------\n";
+    
+    for (int threads : threadCounts) {
+        printf("%7d | %18.2f | %20.2f | %18.2f | %20.2f\n", threads,
+               runConcurrentMix(threads, 1, 95, keyRange, totalOps),
+               runConcurrentMix(threads, 64, 95, keyRange, totalOps),
+               runConcurrentMix(threads, 1, 50, keyRange, totalOps),
+               runConcurrentMix(threads, 64, 50, keyRange, totalOps));
+    }
+}
+
+void demonstrateBatchOperations() {
+    cout << "\n====================================================\n";
+    cout << "  BATCH INSERT / LOOKUP DEMONSTRATION\n";
+    cout << "====================================================\n\n";
+    
+    LinearProbingHashTable<string, int> ht(11);
+    
+    string keys[] = {"Alice", "Bob", "Charlie", "Alice"};
+    int values[] = {25, 30, 35, 26};
+    BatchResult results[4];
+    linearInsertBatch(&ht, keys, values, 4, results);
+    
+    const char* names[] = {"inserted", "updated", "failed"};
+    for (int i = 0; i < 4; i++) {
+        cout << "  " << keys[i] << " → " << names[results[i]] << endl;
+    }
+    
+    string lookups[] = {"Alice", "Diana", "Charlie"};
+    int found[3];
+    bool present[3];
+    linearLookupBatch(&ht, lookups, 3, found, present);
+    for (int i = 0; i < 3; i++) {
+        cout << "  lookup " << lookups[i] << ": ";
+        if (present[i]) cout << found[i] << endl;
+        else cout << "not found" << endl;
+    }
+}
+
+/*
+Table of 8M entries × 16 bytes = 128 MB - far bigger than any CPU cache.
+block = 1 is the same code without overlap (one key at a time).
+*/
+void benchmarkBatchOperations() {
+    cout << "\n====================================================\n";
+    cout << "  BENCHMARK: ONE-AT-A-TIME VS BATCH (Mops/sec)\n";
+    cout << "====================================================\n\n";
+    
+    const int capacity = nextPrime(1 << 23);
+    const int count = capacity / 2;
+    
+    int* keys = new int[count];
+    int* values = new int[count];
+    int* lookedUp = new int[count];     // Lookup output; values stays the insert input
+    BatchResult* results = new BatchResult[count];
+    bool* found = new bool[count];
+    unsigned long long rng = 42;
+    for (int i = 0; i < count; i++) {
+        keys[i] = (int)(nextRandom(&rng) & 0x7FFFFFFF);
+        values[i] = i;
+    }
+    
+    cout << count << " int keys, capacity " << capacity << " (load 0.5)\n\n";
+    cout << "Table     | Insert x1 | Insert x16 | Lookup x1 | Lookup x16\n";
+    cout << "----------|-----------|------------|-----------|-----------\n";
+    
+    for (int kind = 0; kind < 2; kind++) {
+        double rates[4];
+        for (int run = 0; run < 2; run++) {
+            int block = run == 0 ? 1 : BATCH_BLOCK;
+            double insertTime, lookupTime;
+            
+            if (kind == 0) {
+                LinearProbingHashTable<int, int> ht(capacity);
+                auto start = chrono::steady_clock::now();
+                linearInsertBatch(&ht, keys, values, count, results, block);
+                insertTime = secondsSince(start);
+                start = chrono::steady_clock::now();
+                linearLookupBatch(&ht, keys, count, lookedUp, found, block);
+                lookupTime = secondsSince(start);
+            } else {
+                QuadraticProbingHashTable<int, int> ht(capacity);
+                auto start = chrono::steady_clock::now();
+                quadraticInsertBatch(&ht, keys, values, count, results, block);
+                insertTime = secondsSince(start);
+                start = chrono::steady_clock::now();
+                quadraticLookupBatch(&ht, keys, count, lookedUp, found, block);
+                lookupTime = secondsSince(start);
+            }
+            rates[run * 2] = count / insertTime / 1e6;
+            rates[run * 2 + 1] = count / lookupTime / 1e6;
+            
+            for (int i = 0; i < count; i++) {
+                if (!found[i]) {
+                    cout << "Error: key " << keys[i] << " missing after batch insert\n";
+                    break;
+                }
+            }
+        }
+        printf("%-9s | %9.2f | %10.2f | %9.2f | %10.2f\n", kind == 0 ? "Linear" : "Quadratic",
+               rates[0], rates[2], rates[1], rates[3]);
+    }
+    
+    delete[] keys;
+    delete[] values;
+    delete[] lookedUp;
+    delete[] results;
+    delete[] found;
+}
+
 //==============================================================================
 // MAIN FUNCTION
 //==============================================================================
 
-int main() {
+int main(int argc, char* argv[]) {
     cout << "========================================================\n";
     cout << "  TASK 4: HASH TABLE WITH LINEAR & QUADRATIC PROBING\n";
     cout << "========================================================\n";
@@ -681,6 +2407,21 @@ int main() {
     demonstrateLinearProbing();
     demonstrateQuadraticProbing();
     compareProbing();
+    demonstrateRobinHood();
+    compareRobinHood();
+    demonstrateTombstoneCompaction();
+    demonstrateSwissTable();
+    demonstrateConcurrentTable();
+    demonstrateBatchOperations();
+    
+    // ./task4 bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+        benchmarkSwissTable();
+        benchmarkHashFunctions();
+        testHashQuality();
+        benchmarkConcurrentTable();
+        benchmarkBatchOperations();
+    }
     
     cout << "\n========================================================\n";
     cout << "  All demonstrations completed!\n";
@@ -700,7 +2441,8 @@ KEY CONCEPTS SUMMARY
    - Uses hash function to convert key → index
 
 2. HASH FUNCTION:
-   - Converts key to array index: hash(key) % tableSize
+   - Converts key to array index: reduce(hash(key), tableSize)
+   - Hash the whole key to 64 bits first, reduce to an index once
    - Good hash function distributes keys uniformly
    - Prime table size helps reduce collisions
 
@@ -748,7 +2490,8 @@ KEY CONCEPTS SUMMARY
 
 ================================================================================
 COMPILATION AND EXECUTION:
-   g++ -std=c++11 task4_hashtable.cpp -o task4
-   ./task4
+   g++ -std=c++17 -O2 -pthread task4_hashtable.cpp -o task4
+   ./task4          (demonstrations)
+   ./task4 bench    (benchmarks)
 ================================================================================
 */
@@ -46,6 +46,13 @@ Python Comparison:
 */
 
 #include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "../log_policy.h"
 using namespace std;
 
 //==============================================================================
@@ -73,6 +80,15 @@ struct CircularQueue {
     */
 };
 
+//==============================================================================
+// LOGGING POLICY
+//==============================================================================
+
+// enqueue's "queue is full" message prints only under VerboseLog
+// (enqueue<VerboseLog>(...)); -DTEACHING_MODE makes that the default, and
+// enqueue() returns false either way. Errors that end the program (dequeue,
+// getFront, getRear on an empty queue) always go to cerr. See log_policy.h.
+
 //==============================================================================
 // INITIALIZATION
 //==============================================================================
@@ -136,12 +152,13 @@ int size(CircularQueue<T>* queue) {
     return queue->count;
 }
 
-template <typename T>
-void enqueue(CircularQueue<T>* queue, T value) {
+template <typename Log = DefaultLog, typename T>
+bool enqueue(CircularQueue<T>* queue, T value) {
     // Step 1: Check overflow
     if (isFull(queue)) {
-        cout << "Error: Queue Overflow - Queue is full!" << endl;
-        return;
+        if (Log::enabled)
+            cout << "Error: Queue Overflow - Queue is full!" << endl;
+        return false;
     }
     
     // Step 2: Calculate new rear position (circular)
@@ -175,6 +192,7 @@ void enqueue(CircularQueue<T>* queue, T value) {
     
     // Step 4: Increment count
     queue->count++;
+    return true;
 }
 
 //==============================================================================
@@ -198,7 +216,7 @@ template <typename T>
 T dequeue(CircularQueue<T>* queue) {
     // Step 1: Check underflow
     if (isEmpty(queue)) {
-        cout << "Error: Queue Underflow - Queue is empty!" << endl;
+        cerr << "Error: Queue Underflow - Queue is empty!" << endl;
         exit(1);
     }
     
@@ -238,6 +256,98 @@ T dequeue(CircularQueue<T>* queue) {
     return value;
 }
 
+//==============================================================================
+// BATCH OPERATIONS
+//==============================================================================
+
+/*
+ENQUEUE N / DEQUEUE N - move many elements in one call
+------------------------------------------------------
+enqueue()/dequeue() handle one element per call and do a `%` per element.
+A batch of k elements occupies at most TWO contiguous spans of the array:
+one up to the end of the array, and (if it wraps) one from index 0.
+
+    capacity = 8, front = 5, count = 2        enqueueN(6 values: a..f)
+
+    [  ][  ][  ][  ][  ][X ][Y ][  ]          start = (rear + 1) % 8 = 7
+                         ^front  ^rear
+                                              span 1: arr[7..7]  <- a
+    [b ][c ][d ][e ][f ][X ][Y ][a ]          span 2: arr[0..4]  <- b c d e f
+                     ^rear
+
+So a batch costs two bulk copies and ONE modulo, whatever its size.
+
+For trivially copyable T (int, double, plain structs) each span is a single
+memcpy. Other types (string, ...) cannot be memcpy'd safely, so they are
+copied in (enqueueN reads from a const T*) and moved out (dequeueN), one
+element at a time but still without per-element index arithmetic.
+
+Both functions do as much as fits and return how many elements they moved:
+enqueueN stops when the queue is full, dequeueN when it is empty.
+
+Time Complexity: O(k) for k elements moved
+*/
+
+// copySpan/moveSpan: bulk memcpy when T allows it, element-wise otherwise
+template <typename T>
+void copySpan(T* dest, const T* src, int n, true_type /* trivially copyable */) {
+    memcpy(dest, src, n * sizeof(T));
+}
+
+template <typename T>
+void copySpan(T* dest, const T* src, int n, false_type) {
+    for (int i = 0; i < n; i++)
+        dest[i] = src[i];
+}
+
+template <typename T>
+void moveSpan(T* dest, T* src, int n, true_type) {
+    memcpy(dest, src, n * sizeof(T));
+}
+
+template <typename T>
+void moveSpan(T* dest, T* src, int n, false_type) {
+    for (int i = 0; i < n; i++)
+        dest[i] = move(src[i]);
+}
+
+template <typename T>
+int enqueueN(CircularQueue<T>* queue, const T* values, int n) {
+    int k = queue->capacity - queue->count;       // Free slots
+    if (n < k) k = n;
+    if (k <= 0) return 0;
+
+    typename is_trivially_copyable<T>::type trivial;
+    int start = (queue->rear + 1) % queue->capacity;
+    int first = queue->capacity - start;          // Room before the wrap point
+    if (first > k) first = k;
+
+    copySpan(queue->arr + start, values, first, trivial);
+    copySpan(queue->arr, values + first, k - first, trivial);  // Wrapped part (may be 0)
+
+    queue->rear = (start + k - 1) % queue->capacity;
+    queue->count += k;
+    return k;
+}
+
+template <typename T>
+int dequeueN(CircularQueue<T>* queue, T* out, int n) {
+    int k = queue->count;
+    if (n < k) k = n;
+    if (k <= 0) return 0;
+
+    typename is_trivially_copyable<T>::type trivial;
+    int first = queue->capacity - queue->front;   // Elements before the wrap point
+    if (first > k) first = k;
+
+    moveSpan(out, queue->arr + queue->front, first, trivial);
+    moveSpan(out + first, queue->arr, k - first, trivial);
+
+    queue->front = (queue->front + k) % queue->capacity;
+    queue->count -= k;
+    return k;
+}
+
 //==============================================================================
 // PEEK OPERATIONS
 //==============================================================================
@@ -249,7 +359,7 @@ Time Complexity: O(1)
 template <typename T>
 T getFront(CircularQueue<T>* queue) {
     if (isEmpty(queue)) {
-        cout << "Error: Queue is empty!" << endl;
+        cerr << "Error: Queue is empty!" << endl;
         exit(1);
     }
     return queue->arr[queue->front];
@@ -262,7 +372,7 @@ Time Complexity: O(1)
 template <typename T>
 T getRear(CircularQueue<T>* queue) {
     if (isEmpty(queue)) {
-        cout << "Error: Queue is empty!" << endl;
+        cerr << "Error: Queue is empty!" << endl;
         exit(1);
     }
     return queue->arr[queue->rear];
@@ -356,7 +466,7 @@ void demonstrateCircularQueue() {
     
     // Try to enqueue when full
     cout << "\n3. Trying to enqueue 60 (queue is full):\n";
-    enqueue(&queue, 60);
+    enqueue<VerboseLog>(&queue, 60);
     
     // Dequeue some elements
     cout << "\n4. Dequeuing 2 elements:\n";
@@ -395,16 +505,110 @@ void demonstrateCircularQueue() {
     enqueue(&strQueue, string("Circular"));
     display(&strQueue);
     
+    // Batch operations across the wrap point
+    cout << "\n9. Batch: enqueueN 8 values into a queue of capacity 6:\n";
+    CircularQueue<int> batchQueue;
+    initCircularQueue(&batchQueue, 6);
+    enqueue(&batchQueue, 1);
+    enqueue(&batchQueue, 2);
+    enqueue(&batchQueue, 3);
+    dequeue(&batchQueue);
+    dequeue(&batchQueue);           // front=2, rear=2: the batch below wraps
+    
+    int batchIn[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    cout << "   Accepted " << enqueueN(&batchQueue, batchIn, 8) << " of 8\n";
+    display(&batchQueue);
+    
+    int batchOut[8];
+    int got = dequeueN(&batchQueue, batchOut, 4);
+    cout << "   dequeueN(4): ";
+    for (int i = 0; i < got; i++)
+        cout << batchOut[i] << " ";
+    cout << endl;
+    display(&batchQueue);
+    
+    string words[] = {"batched", "strings", "are", "moved"};
+    dequeueN(&strQueue, words, 1);  // Makes room; words[0] = "World"
+    cout << "   String queue took " << enqueueN(&strQueue, words + 1, 3) << " of 3\n";
+    display(&strQueue);
+    
     // Cleanup
     destroyCircularQueue(&queue);
     destroyCircularQueue(&strQueue);
+    destroyCircularQueue(&batchQueue);
+}
+
+//==============================================================================
+// BENCHMARK
+//==============================================================================
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+Pushes `total` elements through a 1000-slot queue in batches: fill `batch`
+elements, then drain them. The capacity is not a multiple of the batch
+size, so batches regularly straddle the wrap point.
+Returns millions of elements per second (each enqueued and dequeued once).
+*/
+template <typename T>
+double timeBatches(const T* input, T* output, int batch, long long total, bool useN) {
+    CircularQueue<T> queue;
+    initCircularQueue(&queue, 1000);
+    long long rounds = total / batch;
+
+    auto start = chrono::steady_clock::now();
+    for (long long r = 0; r < rounds; r++) {
+        if (useN) {
+            enqueueN(&queue, input, batch);
+            dequeueN(&queue, output, batch);
+        } else {
+            for (int i = 0; i < batch; i++)
+                enqueue(&queue, input[i]);
+            for (int i = 0; i < batch; i++)
+                output[i] = dequeue(&queue);
+        }
+    }
+    double elapsed = secondsSince(start);
+
+    destroyCircularQueue(&queue);
+    return rounds * batch / elapsed / 1e6;
+}
+
+void benchmark() {
+    const int batches[] = {16, 64, 256, 512};
+    const long long total = 50000000;
+
+    int ints[512], intsOut[512];
+    for (int i = 0; i < 512; i++)
+        ints[i] = i;
+
+    cout << "\n" << total << " ints through a 1000-slot queue (M elements/sec)\n\n";
+    cout << "Batch | enqueue/dequeue loop | enqueueN/dequeueN\n";
+    cout << "------|----------------------|------------------\n";
+    for (int batch : batches) {
+        double single = timeBatches(ints, intsOut, batch, total, false);
+        double bulk = timeBatches(ints, intsOut, batch, total, true);
+        printf("%5d | %20.1f | %17.1f\n", batch, single, bulk);
+    }
+
+    // Non-trivial type: element-wise copy in, move out
+    const long long stringTotal = 5000000;
+    string strings[256], stringsOut[256];
+    for (int i = 0; i < 256; i++)
+        strings[i] = "message number " + to_string(i) + " with some payload";
+    double single = timeBatches(strings, stringsOut, 256, stringTotal, false);
+    double bulk = timeBatches(strings, stringsOut, 256, stringTotal, true);
+    printf("\n%lld strings, batch 256: loop %.1f, batched %.1f M elements/sec\n",
+           stringTotal, single, bulk);
 }
 
 //==============================================================================
 // MAIN FUNCTION
 //==============================================================================
 
-int main() {
+int main(int argc, char* argv[]) {
     cout << "========================================================\n";
     cout << "  TASK 1: CIRCULAR QUEUE USING STATIC MEMORY (ARRAY)\n";
     cout << "========================================================\n";
@@ -415,6 +619,9 @@ int main() {
     cout << "  Demonstration completed successfully!\n";
     cout << "========================================================\n\n";
     
+    // ./circular_queue bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
     return 0;
 }
 
@@ -0,0 +1,314 @@
+#include <iostream>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "intrusive_list.h"
+using namespace std;
+
+/*
+INTRUSIVE DOUBLY LINKED LIST
+----------------------------
+doublyLinkedList.cpp allocates a Node {data, next, prev} per value and the
+list owns it. To delete a value you first have to find its node (O(n)),
+and every insert is a `new`.
+
+An intrusive list turns this inside out: the caller's own struct carries
+the next/prev links (the "hook"), and the list just threads through them:
+
+    struct Task {
+        int id;
+        ListHook hook;      // next + prev, owned by whichever list Task is in
+    };
+
+            +--------------------------------------------------+
+            v                                                  |
+        [ head ] <-> [ Task 3 | hook ] <-> [ Task 7 | hook ] <-+
+        sentinel
+
+  - the list never allocates: linking a Task only rewrites four pointers
+  - anyone holding a Task* already holds its position in the list, so
+    unlink, insertBefore and insertAfter are O(1), with no search
+  - the sentinel `head` makes the list circular, so first, last, middle
+    and only node are all handled by the same four-pointer update
+  - an object can be in several lists at once by having several hooks
+
+containerOf(hookPtr, Task, hook) gets the Task back from a pointer to its
+hook by subtracting the hook's offset inside Task.
+
+The list does not own anything: the caller must unlink an object before
+freeing it. The code is in intrusive_list.h (lru_cache.cpp uses it too).
+*/
+
+//==============================================================================
+// DEMO
+//==============================================================================
+
+struct Task {
+    int id;
+    int priority;
+    ListHook byAge;        // In the "all tasks, oldest first" list
+    ListHook ready;        // In the "ready to run" list (or not linked)
+};
+
+void displayAll(IntrusiveList* list) {
+    for (ListHook* h = first(list); h != end(list); h = h->next) {
+        Task* t = containerOf(h, Task, byAge);
+        cout << t->id << " -> ";
+    }
+    cout << "NULL" << endl;
+}
+
+void displayReady(IntrusiveList* list) {
+    for (ListHook* h = first(list); h != end(list); h = h->next) {
+        Task* t = containerOf(h, Task, ready);
+        cout << t->id << "(p" << t->priority << ") -> ";
+    }
+    cout << "NULL" << endl;
+}
+
+void demo() {
+    Task tasks[5];
+    IntrusiveList all, ready;
+    initList(&all);
+    initList(&ready);
+
+    for (int i = 0; i < 5; i++) {
+        tasks[i].id = 10 * (i + 1);
+        tasks[i].priority = i % 3;
+        initHook(&tasks[i].byAge);
+        initHook(&tasks[i].ready);
+        pushBack(&all, &tasks[i].byAge);
+        if (tasks[i].priority > 0)
+            pushBack(&ready, &tasks[i].ready);
+    }
+
+    cout << "All tasks:   "; displayAll(&all);
+    cout << "Ready tasks: "; displayReady(&ready);
+
+    // Task 30 is removed from both lists straight from its handle: no search
+    unlink(&tasks[2].byAge);
+    unlink(&tasks[2].ready);
+    cout << "\nAfter unlinking task 30:" << endl;
+    cout << "All tasks:   "; displayAll(&all);
+    cout << "Ready tasks: "; displayReady(&ready);
+
+    // Task 10 becomes ready, placed right before task 50
+    insertBefore(&tasks[4].ready, &tasks[0].ready);
+    moveToFront(&all, &tasks[4].byAge);
+    cout << "\nTask 10 ready before 50, task 50 moved to the front:" << endl;
+    cout << "All tasks:   "; displayAll(&all);
+    cout << "Ready tasks: "; displayReady(&ready);
+}
+
+//==============================================================================
+// BENCHMARK: INTRUSIVE LIST vs NODE-OWNING DOUBLY LINKED LIST
+//==============================================================================
+
+/*
+Built with -DCOUNT_ALLOCATIONS, every `new` goes through this replacement
+operator new so the benchmark can count allocations. A normal build keeps
+the standard operator new.
+*/
+#ifdef COUNT_ALLOCATIONS
+long long allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    void* p = malloc(size);
+    if (p == NULL)
+        throw bad_alloc();
+    return p;
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+#endif
+
+uint64_t nextRandom(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+Baseline: the doublyLinkedList.cpp node, owned by the list and allocated
+with `new` when the item is added. Each item remembers its node, so moving
+an item relinks that node in O(1) with no allocation, exactly like the
+intrusive list. What differs is layout: the links live in a separate heap
+node, reached through item->node, instead of inside the item.
+*/
+struct Node {
+    int data;
+    Node* next;
+    Node* prev;
+};
+
+struct Item {
+    int key;
+    Node* node;            // Baseline handle
+    ListHook hook;         // Intrusive handle
+};
+
+// Takes node out of the list without freeing it
+void detachNode(Node** list, Node* node) {
+    if (node->prev != NULL) node->prev->next = node->next;
+    else *list = node->next;
+    if (node->next != NULL) node->next->prev = node->prev;
+}
+
+void linkNodeAfter(Node* pos, Node* node) {
+    node->prev = pos;
+    node->next = pos->next;
+    if (pos->next != NULL) pos->next->prev = node;
+    pos->next = node;
+}
+
+void linkNodeBefore(Node** list, Node* pos, Node* node) {
+    node->next = pos;
+    node->prev = pos->prev;
+    if (pos->prev != NULL) pos->prev->next = node;
+    else *list = node;
+    pos->prev = node;
+}
+
+/*
+One operation = take a random item out of the list and splice it back in
+next to another random item (alternating before/after), i.e. one unlink
+plus one insert. Both lists run the same picks and the same before/after
+mix; neither allocates while moving items.
+*/
+void benchmark() {
+    const int itemCounts[] = {1000, 1000000};
+    const long long ops = 100000000;
+    const int BATCH = 1000;        // Random picks are drawn a batch at a time
+
+    printf("\n%lld splice/unlink operations\n\n", ops);
+#ifdef COUNT_ALLOCATIONS
+    printf("    Items |   Node-owning DLL |  Intrusive list | allocations to build (DLL / intrusive)\n");
+    printf("----------|-------------------|-----------------|---------------------------------------\n");
+#else
+    printf("    Items |   Node-owning DLL |  Intrusive list\n");
+    printf("----------|-------------------|----------------\n");
+#endif
+
+    for (int count : itemCounts) {
+        Item* items = (Item*)malloc(count * sizeof(Item));
+        uint32_t* picks = (uint32_t*)malloc(2 * BATCH * sizeof(uint32_t));
+        uint64_t seed = 88172645463325252ull;
+
+        // Baseline list: items[0] .. items[count-1], one new Node each
+#ifdef COUNT_ALLOCATIONS
+        long long before = allocations;
+#endif
+        Node* list = NULL;
+        Node* tail = NULL;
+        for (int i = 0; i < count; i++) {
+            items[i].key = i;
+            Node* node = new Node();
+            node->data = i;
+            node->next = NULL;
+            node->prev = tail;
+            if (tail == NULL) list = node;
+            else tail->next = node;
+            tail = node;
+            items[i].node = node;
+        }
+#ifdef COUNT_ALLOCATIONS
+        long long nodeAllocs = allocations - before;
+#endif
+
+        auto start = chrono::steady_clock::now();
+        for (long long op = 0; op < ops; op += BATCH) {
+            for (int k = 0; k < 2 * BATCH; k++)
+                picks[k] = (uint32_t)(nextRandom(&seed) % count);
+            for (int k = 0; k < BATCH; k++) {
+                Node* moving = items[picks[2 * k]].node;
+                Node* target = items[picks[2 * k + 1]].node;
+                if (moving == target)
+                    continue;
+                detachNode(&list, moving);
+                if (k & 1) linkNodeBefore(&list, target, moving);
+                else linkNodeAfter(target, moving);
+            }
+        }
+        double nodeTime = secondsSince(start);
+
+        int seen = 0;
+        while (list != NULL) {
+            Node* next = list->next;
+            delete list;
+            list = next;
+            seen++;
+        }
+        if (seen != count)
+            cout << "Error: node list has " << seen << " items, expected " << count << endl;
+
+        // Intrusive list: same items, same random picks
+#ifdef COUNT_ALLOCATIONS
+        before = allocations;
+#endif
+        IntrusiveList ilist;
+        initList(&ilist);
+        for (int i = 0; i < count; i++) {
+            initHook(&items[i].hook);
+            pushBack(&ilist, &items[i].hook);
+        }
+#ifdef COUNT_ALLOCATIONS
+        long long intrusiveAllocs = allocations - before;
+#endif
+
+        seed = 88172645463325252ull;
+        start = chrono::steady_clock::now();
+        for (long long op = 0; op < ops; op += BATCH) {
+            for (int k = 0; k < 2 * BATCH; k++)
+                picks[k] = (uint32_t)(nextRandom(&seed) % count);
+            for (int k = 0; k < BATCH; k++) {
+                ListHook* moving = &items[picks[2 * k]].hook;
+                ListHook* target = &items[picks[2 * k + 1]].hook;
+                if (moving == target)
+                    continue;
+                unlink(moving);
+                if (k & 1) insertBefore(target, moving);
+                else insertAfter(target, moving);
+            }
+        }
+        double intrusiveTime = secondsSince(start);
+
+        // Still one list holding every item?
+        seen = 0;
+        for (ListHook* h = first(&ilist); h != end(&ilist); h = h->next)
+            seen++;
+        if (seen != count)
+            cout << "Error: list has " << seen << " items, expected " << count << endl;
+
+#ifdef COUNT_ALLOCATIONS
+        printf("%9d | %11.2f ns/op | %9.2f ns/op | %lld / %lld\n", count,
+               nodeTime * 1e9 / ops, intrusiveTime * 1e9 / ops, nodeAllocs, intrusiveAllocs);
+#else
+        printf("%9d | %11.2f ns/op | %9.2f ns/op\n", count,
+               nodeTime * 1e9 / ops, intrusiveTime * 1e9 / ops);
+#endif
+
+        free(picks);
+        free(items);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    demo();
+
+    // ./doublyLinkedList_intrusive bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
+    return 0;
+}
@@ -0,0 +1,100 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <cstddef>
+
+/*
+INTRUSIVE DOUBLY LINKED LIST
+----------------------------
+The hook, list and O(1) link/unlink operations explained in
+doublyLinkedList_intrusive.cpp, shared with lru_cache.cpp's recency list.
+The list never allocates and never owns its nodes.
+*/
+
+struct ListHook {
+    ListHook* next;
+    ListHook* prev;
+};
+
+struct IntrusiveList {
+    ListHook head;      // Sentinel: head.next is the first node, head.prev the last
+};
+
+#define containerOf(ptr, Type, member) \
+    ((Type*)((char*)(ptr) - offsetof(Type, member)))
+
+inline void initList(IntrusiveList* list) {
+    list->head.next = &list->head;
+    list->head.prev = &list->head;
+}
+
+inline void initHook(ListHook* node) {
+    node->next = NULL;
+    node->prev = NULL;
+}
+
+inline bool isEmpty(const IntrusiveList* list) {
+    return list->head.next == &list->head;
+}
+
+inline bool isLinked(const ListHook* node) {
+    return node->next != NULL;
+}
+
+// Links node (not in any list) right after pos
+inline void insertAfter(ListHook* pos, ListHook* node) {
+    node->prev = pos;
+    node->next = pos->next;
+    pos->next->prev = node;
+    pos->next = node;
+}
+
+// Links node (not in any list) right before pos
+inline void insertBefore(ListHook* pos, ListHook* node) {
+    insertAfter(pos->prev, node);
+}
+
+// Takes node out of whatever list it is in; the list is not needed
+inline void unlink(ListHook* node) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    node->next = NULL;
+    node->prev = NULL;
+}
+
+inline void pushFront(IntrusiveList* list, ListHook* node) {
+    insertAfter(&list->head, node);
+}
+
+inline void pushBack(IntrusiveList* list, ListHook* node) {
+    insertBefore(&list->head, node);
+}
+
+// NULL when the list is empty
+inline ListHook* front(IntrusiveList* list) {
+    return isEmpty(list) ? NULL : list->head.next;
+}
+
+inline ListHook* back(IntrusiveList* list) {
+    return isEmpty(list) ? NULL : list->head.prev;
+}
+
+// Unlinks and returns the last node, or NULL
+inline ListHook* popBack(IntrusiveList* list) {
+    ListHook* node = back(list);
+    if (node != NULL)
+        unlink(node);
+    return node;
+}
+
+// The LRU step: node (already in list) becomes the first node
+inline void moveToFront(IntrusiveList* list, ListHook* node) {
+    unlink(node);
+    pushFront(list, node);
+}
+
+// Iteration: for (ListHook* h = first(list); h != end(list); h = h->next)
+inline ListHook* first(IntrusiveList* list) { return list->head.next; }
+inline ListHook* end(IntrusiveList* list) { return &list->head; }
+
+#endif
@@ -1,73 +1,323 @@
 #include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "../log_policy.h"
 using namespace std;
 
-const int SIZE = 10;
-int hashTable[SIZE];
+/*
+RESIZABLE LINEAR PROBING
+------------------------
+The old version used a global `int hashTable[10]`, so the 11th insert failed
+with "Hash Table is full!" and search() had to walk the whole array once the
+table was nearly full.
 
-// Initialize table with -1 (empty)
-void initHashTable() {
-    for (int i = 0; i < SIZE; i++)
-        hashTable[i] = -1;
+Now the table lives on the heap and:
+  - capacity is always a power of two, so `% SIZE` becomes `& mask`
+  - once size/capacity passes maxLoad we double the capacity and rehash
+  - the load factor stays below maxLoad, so every probe run ends at an
+    empty slot quickly (O(1) expected probes)
+
+Keys are non-negative ints; -1 still means "empty slot".
+*/
+
+// insert() and search() print only under VerboseLog (insert<VerboseLog>(&ht, 10));
+// -DTEACHING_MODE makes that the default (see log_policy.h).
+
+const int EMPTY = -1;
+const int INITIAL_CAPACITY = 16;        // must be a power of two
+const double MAX_LOAD_FACTOR = 0.75;
+
+struct HashTable {
+    int* slots;        // heap array of keys (EMPTY = free)
+    size_t capacity;   // always a power of two
+    size_t mask;       // capacity - 1
+    int shift;         // 64 - log2(capacity), used by hashFunc
+    size_t size;       // number of keys stored
+    double maxLoad;    // grow when size / capacity would pass this
+};
+
+void initHashTable(HashTable* ht, size_t capacity = INITIAL_CAPACITY,
+                   double maxLoad = MAX_LOAD_FACTOR) {
+    // round capacity up to a power of two
+    size_t cap = 1;
+    int bits = 0;
+    while (cap < capacity) {
+        cap <<= 1;
+        bits++;
+    }
+
+    ht->slots = new int[cap];
+    for (size_t i = 0; i < cap; i++)
+        ht->slots[i] = EMPTY;
+
+    ht->capacity = cap;
+    ht->mask = cap - 1;
+    ht->shift = 64 - bits;
+    ht->size = 0;
+    ht->maxLoad = maxLoad;
+}
+
+void destroyHashTable(HashTable* ht) {
+    delete[] ht->slots;
+    ht->slots = NULL;
+    ht->capacity = 0;
+    ht->size = 0;
 }
 
-int hashFunc(int key) {
-    return key % SIZE;
+/*
+Fibonacci (multiplicative) hashing: multiply by 2^64 / golden ratio and keep
+the top bits. Plain `key & mask` would put keys like 16, 32, 48 ... all in
+slot 0; the multiply spreads every input bit into the index.
+*/
+size_t hashFunc(const HashTable* ht, int key) {
+    if (ht->shift == 64) return 0;  // capacity 1
+    return (size_t)(((uint64_t)(uint32_t)key * 11400714819323198485ull) >> ht->shift);
 }
 
-bool insert(int key) {
-    int index = hashFunc(key);
-    int startIndex = index;
+// Place a key that is known not to be in the table (used by rehash)
+void placeKey(HashTable* ht, int key) {
+    size_t index = hashFunc(ht, key);
+    while (ht->slots[index] != EMPTY)
+        index = (index + 1) & ht->mask;
+    ht->slots[index] = key;
+    ht->size++;
+}
 
-    while (hashTable[index] != -1) {
-        index = (index + 1) % SIZE;  // linear probing
-        if (index == startIndex) {   // table full
-            cout << "Hash Table is full!" << endl;
-            return false;
-        }
+// Double the capacity and reinsert every key
+void rehash(HashTable* ht, size_t newCapacity) {
+    int* oldSlots = ht->slots;
+    size_t oldCapacity = ht->capacity;
+
+    initHashTable(ht, newCapacity, ht->maxLoad);
+    for (size_t i = 0; i < oldCapacity; i++) {
+        if (oldSlots[i] != EMPTY)
+            placeKey(ht, oldSlots[i]);
     }
+    delete[] oldSlots;
+}
 
-    hashTable[index] = key;
-    cout << "Inserted " << key << " at index " << index << endl;
-    return true;
+/*
+Returns the slot index of `key`, or -1 if it is not in the table.
+The load factor guarantees an EMPTY slot, so the loop always ends.
+*/
+long findSlot(const HashTable* ht, int key) {
+    size_t index = hashFunc(ht, key);
+    while (ht->slots[index] != EMPTY) {
+        if (ht->slots[index] == key)
+            return (long)index;
+        index = (index + 1) & ht->mask;  // linear probing
+    }
+    return -1;
 }
 
-bool search(int key) {
-    int index = hashFunc(key);
-    int startIndex = index;
+/*
+Inserts `key` (growing first if needed) and returns its slot index.
+If the key is already present, its existing slot is returned.
+*/
+long insertKey(HashTable* ht, int key) {
+    if ((double)(ht->size + 1) > ht->maxLoad * (double)ht->capacity)
+        rehash(ht, ht->capacity * 2);
+
+    size_t index = hashFunc(ht, key);
+    while (ht->slots[index] != EMPTY) {
+        if (ht->slots[index] == key)
+            return (long)index;
+        index = (index + 1) & ht->mask;
+    }
+    ht->slots[index] = key;
+    ht->size++;
+    return (long)index;
+}
 
-    while (hashTable[index] != -1) {
-        if (hashTable[index] == key) {
+template <typename Log = DefaultLog>
+bool insert(HashTable* ht, int key) {
+    if (key < 0) {
+        if (Log::enabled)
+            cout << "Only non-negative keys are supported" << endl;
+        return false;
+    }
+    long index = insertKey(ht, key);
+    if (Log::enabled)
+        cout << "Inserted " << key << " at index " << index << endl;
+    return true;
+}
+
+template <typename Log = DefaultLog>
+bool search(const HashTable* ht, int key) {
+    long index = findSlot(ht, key);
+    if (index != -1) {
+        if (Log::enabled)
             cout << "Key " << key << " found at index " << index << endl;
-            return true;
-        }
-        index = (index + 1) % SIZE;
-        if (index == startIndex)
-            break;  // full circle
+        return true;
     }
-    cout << "Key " << key << " not found in hash table" << endl;
+    if (Log::enabled)
+        cout << "Key " << key << " not found in hash table" << endl;
     return false;
 }
 
-void display() {
-    cout << "Hash Table: ";
-    for (int i = 0; i < SIZE; i++) {
-        if (hashTable[i] != -1)
-            cout << hashTable[i] << " ";
+void display(const HashTable* ht) {
+    cout << "Hash Table (size " << ht->size << ", capacity " << ht->capacity << "): ";
+    for (size_t i = 0; i < ht->capacity; i++) {
+        if (ht->slots[i] != EMPTY)
+            cout << ht->slots[i] << " ";
         else
             cout << "_ ";
     }
     cout << endl;
 }
 
-int main() {
-    initHashTable();
-    insert(10);
-    insert(20);
-    insert(30);
-    insert(25);
-    insert(35);
-    display();
-    search(20);
-    search(50);
+//==============================================================================
+// BENCHMARK
+//==============================================================================
+
+// xorshift64 - fast reproducible random keys for the benchmark
+uint64_t nextRandom(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+Fills a table of fixed capacity to each target load factor and measures:
+  - inserts/sec
+  - successful lookups/sec   (keys that are in the table)
+  - unsuccessful lookups/sec (keys that are not)
+Inserted keys are even and missing keys are odd, so a miss is guaranteed.
+maxLoad is set above 0.9 so no rehash happens during the measurement.
+*/
+void benchmarkLoadFactors() {
+    const size_t capacity = 1 << 22;  // 4M slots = 16 MB of keys
+    const double loads[] = {0.5, 0.6, 0.7, 0.8, 0.9};
+
+    size_t maxKeys = (size_t)(0.9 * capacity);
+    int* keys = new int[maxKeys];
+    int* missing = new int[maxKeys];
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < maxKeys; i++) {
+        keys[i] = (int)(nextRandom(&state) & 0x3FFFFFFE);         // even
+        missing[i] = (int)(nextRandom(&state) & 0x3FFFFFFE) | 1;  // odd
+    }
+
+    cout << "\nCapacity: " << capacity << " slots\n";
+    cout << "Load | Inserts/sec | Hits/sec    | Misses/sec\n";
+    cout << "-----|-------------|-------------|------------\n";
+
+    for (double load : loads) {
+        size_t n = (size_t)(load * capacity);
+
+        HashTable ht;
+        initHashTable(&ht, capacity, 0.95);
+
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++)
+            insertKey(&ht, keys[i]);
+        double insertTime = secondsSince(start);
+
+        size_t found = 0;
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++)
+            found += findSlot(&ht, keys[i]) != -1;
+        double hitTime = secondsSince(start);
+
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++)
+            found += findSlot(&ht, missing[i]) != -1;
+        double missTime = secondsSince(start);
+
+        if (found != n)
+            cout << "  (unexpected: " << found << " of " << n << " lookups matched)\n";
+
+        printf(" %.1f | %11.0f | %11.0f | %11.0f\n", load,
+               n / insertTime, n / hitTime, n / missTime);
+
+        destroyHashTable(&ht);
+    }
+
+    delete[] keys;
+    delete[] missing;
+}
+
+/*
+Same insert()/search() calls with the two logging policies. The verbose
+run writes to /dev/null, so this measures formatting and write calls
+without a terminal in the way (a real terminal is slower still).
+*/
+template <typename Log>
+double timeOperations(int n) {
+    HashTable ht;
+    initHashTable(&ht);
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+        insert<Log>(&ht, i * 7);
+    for (int i = 0; i < n; i++)
+        search<Log>(&ht, i * 3);
+    double elapsed = secondsSince(start);
+    destroyHashTable(&ht);
+    return 2.0 * n / elapsed;
+}
+
+void benchmarkLogging() {
+    const int n = 200000;
+    ofstream devNull("/dev/null");
+    streambuf* saved = cout.rdbuf(devNull.rdbuf());
+    double verbose = timeOperations<VerboseLog>(n);
+    cout.rdbuf(saved);
+    double silent = timeOperations<SilentLog>(n);
+
+    cout << "\nLogging policy (" << 2 * n << " inserts + searches):\n";
+    printf("  VerboseLog: %12.0f ops/sec\n", verbose);
+    printf("  SilentLog:  %12.0f ops/sec (%.0fx faster)\n", silent, silent / verbose);
+}
+
+// Start from 16 slots and let the table grow while loading millions of keys
+void benchmarkGrowth() {
+    const size_t n = 8000000;
+    HashTable ht;
+    initHashTable(&ht);
+
+    uint64_t state = 12345;
+    auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+        insertKey(&ht, (int)(nextRandom(&state) & 0x7FFFFFFF));
+    double elapsed = secondsSince(start);
+
+    cout << "\nGrowth: " << ht.size << " distinct keys in " << elapsed << " s ("
+         << (size_t)(n / elapsed) << " inserts/sec), final capacity "
+         << ht.capacity << ", load " << (double)ht.size / ht.capacity << endl;
+
+    destroyHashTable(&ht);
+}
+
+int main(int argc, char* argv[]) {
+    HashTable ht;
+    initHashTable(&ht, 8);
+    insert<VerboseLog>(&ht, 10);
+    insert<VerboseLog>(&ht, 20);
+    insert<VerboseLog>(&ht, 30);
+    insert<VerboseLog>(&ht, 25);
+    insert<VerboseLog>(&ht, 35);
+    insert<VerboseLog>(&ht, 45);
+    insert<VerboseLog>(&ht, 55);  // passes the 0.75 load factor -> table grows to 16
+    display(&ht);
+    search<VerboseLog>(&ht, 20);
+    search<VerboseLog>(&ht, 50);
+    destroyHashTable(&ht);
+
+    // ./linearProbing bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+        benchmarkLoadFactors();
+        benchmarkGrowth();
+        benchmarkLogging();
+    }
     return 0;
 }
@@ -0,0 +1,334 @@
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+using namespace std;
+
+/*
+INDEX-BASED (STRUCTURE OF ARRAYS) LINKED LIST
+---------------------------------------------
+The usual node
+
+    struct Node { int data; Node* next; };     4 + 4 (padding) + 8 = 16 bytes
+
+spends more on the link than on the value, and every `new Node()` lands
+wherever the heap puts it (plus the heap's own header per node).
+
+Here the nodes are slots in two parallel arrays, and a link is the slot
+number of the next node (a 32-bit index) instead of an address:
+
+    slot:    0     1     2     3     4
+    data: [ 10 ][ 30 ][ 20 ][  - ][ 40 ]
+    next: [  2 ][  4 ][  1 ][ NIL][ NIL]      head = 0, tail = 4
+                                  ^ slot 3 is on the free list
+
+    list: 10 → 20 → 30 → 40
+
+  - 4 bytes of data + 4 bytes of link = 8 bytes per node, no heap header
+  - nodes appended in order sit in consecutive slots, so walking the list
+    reads both arrays front to back, which the hardware prefetcher loves
+  - deleted slots go on a free list (linked through next[]) and are reused
+    by the next insert
+  - growing doubles both arrays; indices stay valid after the copy, where
+    pointers would not
+
+A list can hold at most 2^32 - 1 nodes (NIL = 0xFFFFFFFF marks the end).
+*/
+
+const uint32_t NIL = 0xFFFFFFFF;
+
+struct IndexedList {
+    int* data;
+    uint32_t* next;
+    uint32_t capacity;   // Slots in data[] / next[]
+    uint32_t used;       // Slots ever handed out (the rest are untouched)
+    uint32_t head;
+    uint32_t tail;
+    uint32_t freeList;   // Deleted slots, linked through next[]
+    uint32_t size;
+};
+
+void initList(IndexedList* list, uint32_t capacity = 16) {
+    if (capacity == 0) capacity = 1;
+    list->data = (int*)malloc(capacity * sizeof(int));
+    list->next = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+    list->capacity = capacity;
+    list->used = 0;
+    list->head = list->tail = NIL;
+    list->freeList = NIL;
+    list->size = 0;
+}
+
+void destroyList(IndexedList* list) {
+    free(list->data);
+    free(list->next);
+    list->data = NULL;
+    list->next = NULL;
+    list->capacity = list->used = list->size = 0;
+    list->head = list->tail = list->freeList = NIL;
+}
+
+// Reuses a deleted slot if there is one, else takes the next fresh slot
+uint32_t allocSlot(IndexedList* list) {
+    if (list->freeList != NIL) {
+        uint32_t slot = list->freeList;
+        list->freeList = list->next[slot];
+        return slot;
+    }
+    if (list->used == list->capacity) {
+        uint32_t newCapacity = list->capacity > NIL / 2 ? NIL : list->capacity * 2;
+        if (newCapacity == list->capacity) {
+            cout << "List is full" << endl;
+            exit(1);
+        }
+        list->data = (int*)realloc(list->data, newCapacity * sizeof(int));
+        list->next = (uint32_t*)realloc(list->next, newCapacity * sizeof(uint32_t));
+        if (list->data == NULL || list->next == NULL) {
+            cout << "Out of memory" << endl;
+            exit(1);
+        }
+        list->capacity = newCapacity;
+    }
+    return list->used++;
+}
+
+// Appends at the tail: O(1)
+void insert(IndexedList* list, int value) {
+    uint32_t slot = allocSlot(list);
+    list->data[slot] = value;
+    list->next[slot] = NIL;
+
+    if (list->head == NIL)
+        list->head = slot;
+    else
+        list->next[list->tail] = slot;
+    list->tail = slot;
+    list->size++;
+}
+
+void display(const IndexedList* list) {
+    for (uint32_t cur = list->head; cur != NIL; cur = list->next[cur])
+        cout << list->data[cur] << " -> ";
+    cout << "NULL" << endl;
+}
+
+// Position of the first node holding value, or -1
+long long search(const IndexedList* list, int value) {
+    long long position = 0;
+    for (uint32_t cur = list->head; cur != NIL; cur = list->next[cur]) {
+        if (list->data[cur] == value)
+            return position;
+        position++;
+    }
+    return -1;
+}
+
+// Unlinks the first node holding value and puts its slot on the free list
+bool deleteElement(IndexedList* list, int value) {
+    uint32_t prev = NIL;
+    for (uint32_t cur = list->head; cur != NIL; prev = cur, cur = list->next[cur]) {
+        if (list->data[cur] == value) {
+            if (prev == NIL) list->head = list->next[cur];
+            else list->next[prev] = list->next[cur];
+            if (cur == list->tail) list->tail = prev;
+
+            list->next[cur] = list->freeList;
+            list->freeList = cur;
+            list->size--;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+After many deletes and inserts, list order and slot order drift apart and
+traversal jumps around the arrays again. compactList rewrites the nodes
+into slots 0..size-1 in list order (and drops the free list), which makes
+the next walk a straight sequential scan.
+*/
+void compactList(IndexedList* list) {
+    int* data = (int*)malloc((list->size > 0 ? list->size : 1) * sizeof(int));
+    uint32_t* next = (uint32_t*)malloc((list->size > 0 ? list->size : 1) * sizeof(uint32_t));
+    uint32_t slot = 0;
+    for (uint32_t cur = list->head; cur != NIL; cur = list->next[cur]) {
+        data[slot] = list->data[cur];
+        next[slot] = slot + 1;
+        slot++;
+    }
+    free(list->data);
+    free(list->next);
+    list->data = data;
+    list->next = next;
+    list->capacity = list->size > 0 ? list->size : 1;
+    list->used = list->size;
+    list->freeList = NIL;
+    if (list->size == 0) {
+        list->head = list->tail = NIL;
+    } else {
+        list->head = 0;
+        list->tail = list->size - 1;
+        list->next[list->tail] = NIL;
+    }
+}
+
+//==============================================================================
+// BENCHMARK: POINTER NODES vs INDEXED LIST
+//==============================================================================
+
+// The Week 3 node, one `new` per element
+struct Node {
+    int data;
+    Node* next;
+};
+
+uint64_t nextRandom(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Same walk as linkedList_Search.cpp's search(), without the printing
+long long searchPointer(Node* list, int value) {
+    long long position = 0;
+    for (Node* cur = list; cur != NULL; cur = cur->next) {
+        if (cur->data == value)
+            return position;
+        position++;
+    }
+    return -1;
+}
+
+/*
+Two layouts for each list of n nodes:
+  - in order: nodes allocated in the order they are linked (a freshly
+    built list)
+  - shuffled: list order is a random permutation of allocation order,
+    like a list that has seen lots of inserts and deletes
+Each search looks for a value that is not there, so it walks all n nodes.
+The shuffled indexed list is then compacted and walked once more.
+*/
+void benchmark() {
+    const uint32_t n = 10000000;
+    const int walks = 5;
+
+    uint32_t* order = new uint32_t[n];
+    for (uint32_t i = 0; i < n; i++)
+        order[i] = i;
+
+    printf("\n%u-node list, ns per node visited (search for a missing value)\n\n", n);
+    printf("  Layout   | Node* list | Indexed list | Speedup\n");
+    printf("-----------|------------|--------------|--------\n");
+
+    for (int shuffled = 0; shuffled <= 1; shuffled++) {
+        if (shuffled) {
+            uint64_t seed = 88172645463325252ull;
+            for (uint32_t i = n - 1; i > 0; i--) {
+                uint32_t j = (uint32_t)(nextRandom(&seed) % (i + 1));
+                uint32_t t = order[i]; order[i] = order[j]; order[j] = t;
+            }
+        }
+
+        // Pointer list: node k of the list is the order[k]-th allocation
+        Node** nodes = new Node*[n];
+        for (uint32_t i = 0; i < n; i++) {
+            nodes[i] = new Node();
+            nodes[i]->data = (int)i;
+        }
+        for (uint32_t k = 0; k + 1 < n; k++)
+            nodes[order[k]]->next = nodes[order[k + 1]];
+        nodes[order[n - 1]]->next = NULL;
+        Node* list = nodes[order[0]];
+
+        // Indexed list: node k of the list lives in slot order[k]
+        IndexedList ilist;
+        initList(&ilist, n);
+        for (uint32_t i = 0; i < n; i++)
+            ilist.data[i] = (int)i;
+        for (uint32_t k = 0; k + 1 < n; k++)
+            ilist.next[order[k]] = order[k + 1];
+        ilist.next[order[n - 1]] = NIL;
+        ilist.used = ilist.size = n;
+        ilist.head = order[0];
+        ilist.tail = order[n - 1];
+
+        long long found = 0;
+        auto start = chrono::steady_clock::now();
+        for (int w = 0; w < walks; w++)
+            found += searchPointer(list, -1);
+        double pointerTime = secondsSince(start);
+
+        start = chrono::steady_clock::now();
+        for (int w = 0; w < walks; w++)
+            found += search(&ilist, -1);
+        double indexedTime = secondsSince(start);
+
+        double perNode = 1e9 / ((double)n * walks);
+        printf("%10s | %10.2f | %12.2f | %6.2fx\n", shuffled ? "shuffled" : "in order",
+               pointerTime * perNode, indexedTime * perNode, pointerTime / indexedTime);
+
+        // Rewriting the shuffled list in list order makes it a sequential walk again
+        if (shuffled) {
+            compactList(&ilist);
+            start = chrono::steady_clock::now();
+            for (int w = 0; w < walks; w++)
+                found += search(&ilist, -1);
+            double compactTime = secondsSince(start);
+            printf("%10s | %10s | %12.2f | %6.2fx\n", "compacted", "-",
+                   compactTime * perNode, pointerTime / compactTime);
+        }
+
+        if (found != (shuffled ? -3 : -2) * walks)
+            cout << "Error: found a value that is not in the list" << endl;
+
+        for (uint32_t i = 0; i < n; i++)
+            delete nodes[i];
+        delete[] nodes;
+        destroyList(&ilist);
+    }
+
+    printf("\nBytes per node: Node* list %zu (+ heap header per new), indexed list %zu\n",
+           sizeof(Node), sizeof(int) + sizeof(uint32_t));
+    delete[] order;
+}
+
+int main(int argc, char* argv[]) {
+    IndexedList list;
+    initList(&list, 4);
+
+    for (int value = 10; value <= 50; value += 10)
+        insert(&list, value);
+    display(&list);
+
+    cout << "30 found at position " << search(&list, 30) << endl;
+    cout << "99 found at position " << search(&list, 99) << endl;
+
+    deleteElement(&list, 10);    // Head
+    deleteElement(&list, 50);    // Tail
+    deleteElement(&list, 30);    // Middle
+    display(&list);
+
+    insert(&list, 60);           // Reuses the slot 30 had
+    insert(&list, 70);
+    display(&list);
+    cout << "size " << list.size << ", slots used " << list.used << endl;
+
+    compactList(&list);
+    display(&list);
+
+    destroyList(&list);
+
+    // ./linkedList_indexed bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
+    return 0;
+}
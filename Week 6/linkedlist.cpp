@@ -1,57 +1,505 @@
 #include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
 using namespace std;
 
-class Node{
+/*
+LINKED LIST WITH HEAD, TAIL AND SIZE
+------------------------------------
+The lists in Week 2 / Week 3 keep one global `Node* list` and append by
+walking to the end every time:
+
+    list → [1] → [2] → [3] → ... → [n] → NULL
+                                    ^ insert() walks n steps to get here
+
+so building an n-element list costs 1 + 2 + ... + n = O(n²) steps.
+
+LinkedList<T> remembers the last node as well as the first:
+
+    head → [1] → [2] → [3] → ... → [n] → NULL
+                                    ^ tail
+
+push_back links the new node after tail and moves tail: O(1).
+push_front links it before head: O(1). size is kept in a counter, so it
+is O(1) too.
+
+Each LinkedList is an ordinary object, so a program can have as many
+independent lists as it wants (the global `list` allowed only one).
+*/
+
+/*
+NODE ALLOCATORS
+---------------
+Every node normally comes from its own `new` and goes back with its own
+`delete`, so a list of n nodes is n trips through the heap to build and n
+more to destroy, and the nodes end up wherever the heap put them.
+
+A NodeArena (monotonic buffer) hands out memory by bumping a pointer
+through big blocks:
+
+    block: [node1][node2][node3][node4][ ...free... ]
+                                       ^next
+
+    allocate(bytes) = return next; next += bytes      (pointer bump)
+    deallocate(p)   = nothing                         (memory stays put)
+    reset()         = next = start of the block       (all nodes at once)
+
+Nodes sit side by side in the order they were allocated, and throwing a
+whole list away is a single reset() (or the arena's destructor), not one
+free per node. The price: memory from remove/pop_front is only reclaimed
+when the whole arena is reset, so it suits short-lived lists (build, use,
+drop), not long-lived ones with lots of churn.
+
+LinkedList takes the allocator as a second template parameter:
+
+    LinkedList<int> a;                                   // new / delete
+    NodeArena arena;
+    LinkedList<int, ArenaAlloc> b((ArenaAlloc(&arena))); // pointer bumps
+*/
+
+// Default: one heap allocation per node
+struct HeapAlloc {
+    static const bool bulkRelease = false;   // Nodes must be freed one by one
+
+    void* allocate(size_t bytes, size_t) { return ::operator new(bytes); }
+    void deallocate(void* p, size_t) { ::operator delete(p); }
+};
+
+class NodeArena {
+    struct Block {
+        Block* next;          // Older block
+        size_t size;          // Usable bytes after the header
+    };
+
+    static const size_t FIRST_BLOCK_SIZE = 64 * 1024;
+
+    Block* blocks;            // Newest (and largest) block first
+    char* next;               // Next free byte in the newest block
+    char* end;                // One past its last byte
+
+    static char* start(Block* b) { return (char*)(b + 1); }
+
+    // Each new block is twice the previous one, so n nodes need O(log n) mallocs
+    void addBlock(size_t bytes) {
+        size_t size = blocks == NULL ? FIRST_BLOCK_SIZE : blocks->size * 2;
+        while (size < bytes)
+            size *= 2;
+        Block* b = (Block*)malloc(sizeof(Block) + size);
+        if (b == NULL)
+            throw bad_alloc();
+        b->size = size;
+        b->next = blocks;
+        blocks = b;
+        next = start(b);
+        end = next + size;
+    }
+
+    void freeOlderBlocks() {
+        Block* b = blocks->next;
+        while (b != NULL) {
+            Block* older = b->next;
+            free(b);
+            b = older;
+        }
+        blocks->next = NULL;
+    }
+
 public:
-    int data;
-    Node* next;
+    NodeArena() : blocks(NULL), next(NULL), end(NULL) {}
 
-    Node (int val){
-        data = val;
-        next = NULL;
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    ~NodeArena() {
+        if (blocks != NULL) {
+            freeOlderBlocks();
+            free(blocks);
+        }
+    }
+
+    void* allocate(size_t bytes, size_t align = alignof(max_align_t)) {
+        size_t pad = (align - (size_t)next % align) % align;
+        if ((size_t)(end - next) < pad + bytes) {
+            addBlock(bytes + align);
+            pad = (align - (size_t)next % align) % align;
+        }
+        char* p = next + pad;
+        next = p + bytes;
+        return p;
+    }
+
+    /*
+    Drops everything allocated so far in one step. Only the newest (largest)
+    block is kept and rewound, so after a few cycles a build/drop cycle fits
+    in one block and never touches the heap at all.
+    */
+    void reset() {
+        if (blocks == NULL)
+            return;
+        freeOlderBlocks();
+        next = start(blocks);
+        end = next + blocks->size;
+    }
+
+    size_t bytesReserved() const {
+        size_t total = 0;
+        for (Block* b = blocks; b != NULL; b = b->next)
+            total += b->size;
+        return total;
     }
 };
 
-class List{
-    Node *head;
-    Node *tail;
+// Allocator handle for LinkedList: nodes come from (and die with) an arena
+struct ArenaAlloc {
+    static const bool bulkRelease = true;    // The arena frees nodes in bulk
+
+    NodeArena* arena;
+
+    explicit ArenaAlloc(NodeArena* a) : arena(a) {}
+
+    void* allocate(size_t bytes, size_t align) { return arena->allocate(bytes, align); }
+    void deallocate(void*, size_t) {}
+};
+
+template <typename T, typename Alloc = HeapAlloc>
+class LinkedList {
+    struct Node {
+        T data;
+        Node* next;
+
+        Node(const T& val) : data(val), next(NULL) {}
+    };
+
+    Node* head;
+    Node* tail;
+    size_t count;
+    Alloc alloc;
+
+    Node* newNode(const T& val) {
+        return new (alloc.allocate(sizeof(Node), alignof(Node))) Node(val);
+    }
+
+    void deleteNode(Node* node) {
+        node->~Node();
+        alloc.deallocate(node, sizeof(Node));
+    }
 
 public:
-    List(){
-        head = tail = NULL;
+    explicit LinkedList(Alloc a = Alloc()) : head(NULL), tail(NULL), count(0), alloc(a) {}
+
+    // Copy: a new list with copies of the same elements, same order
+    // (from the same allocator)
+    LinkedList(const LinkedList& other) : head(NULL), tail(NULL), count(0), alloc(other.alloc) {
+        for (Node* curr = other.head; curr != NULL; curr = curr->next)
+            push_back(curr->data);
     }
 
-    void insert(int val){
-        Node* newNode = new Node (val);
-        if (head==NULL){
-            head = tail = newNode;
-            return;
+    // Move: take other's nodes, leave it empty
+    LinkedList(LinkedList&& other) noexcept
+        : head(other.head), tail(other.tail), count(other.count), alloc(other.alloc) {
+        other.head = other.tail = NULL;
+        other.count = 0;
+    }
+
+    // Copy and move assignment (copy-and-swap)
+    LinkedList& operator=(LinkedList other) noexcept {
+        swap(head, other.head);
+        swap(tail, other.tail);
+        swap(count, other.count);
+        swap(alloc, other.alloc);
+        return *this;
+    }
+
+    ~LinkedList() {
+        clear();
+    }
+
+    // O(1): link after the current tail
+    void push_back(const T& val) {
+        Node* node = newNode(val);
+        if (tail == NULL) {
+            head = tail = node;
+        } else {
+            tail->next = node;
+            tail = node;
+        }
+        count++;
+    }
+
+    // O(1): link before the current head
+    void push_front(const T& val) {
+        Node* node = newNode(val);
+        node->next = head;
+        head = node;
+        if (tail == NULL)
+            tail = node;
+        count++;
+    }
+
+    // Removes the first element; false if the list is empty
+    bool pop_front() {
+        if (head == NULL)
+            return false;
+        Node* old = head;
+        head = head->next;
+        if (head == NULL)
+            tail = NULL;
+        deleteNode(old);
+        count--;
+        return true;
+    }
+
+    // Removes the first node holding val (keeps tail correct); O(n)
+    bool remove(const T& val) {
+        Node* prev = NULL;
+        for (Node* curr = head; curr != NULL; prev = curr, curr = curr->next) {
+            if (curr->data == val) {
+                if (prev == NULL) head = curr->next;
+                else prev->next = curr->next;
+                if (curr == tail) tail = prev;
+                deleteNode(curr);
+                count--;
+                return true;
+            }
         }
-        else{
-            newNode->next = head;
+        return false;
+    }
+
+    bool contains(const T& val) const {
+        for (Node* curr = head; curr != NULL; curr = curr->next) {
+            if (curr->data == val)
+                return true;
         }
+        return false;
     }
 
-    void display(){
-        Node *temp = head;
-        while(temp->next != NULL){
-            cout << temp->data << "";
-            temp = temp->next;
+    // Call only on a non-empty list
+    const T& front() const { return head->data; }
+    const T& back() const { return tail->data; }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    /*
+    With an arena and a T that needs no destructor (int, double, ...) there
+    is nothing to do per node: the list just forgets them and the arena's
+    reset() takes the memory back in one go.
+    */
+    void clear() {
+        if (!(Alloc::bulkRelease && is_trivially_destructible<T>::value)) {
+            while (head != NULL) {
+                Node* next = head->next;
+                deleteNode(head);
+                head = next;
+            }
+        }
+        head = NULL;
+        tail = NULL;
+        count = 0;
+    }
+
+    // Visits every element in order: list.forEach([](int x) { ... });
+    template <typename F>
+    void forEach(F visit) const {
+        for (Node* curr = head; curr != NULL; curr = curr->next)
+            visit(curr->data);
+    }
+
+    void display() const {
+        for (Node* curr = head; curr != NULL; curr = curr->next)
+            cout << curr->data << " -> ";
+        cout << "NULL" << endl;
+    }
+};
+
+//==============================================================================
+// BENCHMARK: GLOBAL LIST WITH TAIL WALK vs LinkedList<T>
+//==============================================================================
+
+// The Week 3 linkedList_Delete.cpp insert(): walk to the end every time
+struct Node {
+    int data;
+    Node* next;
+};
+
+Node* list = NULL;
+
+void insert(int value) {
+    Node* temp = new Node();
+    temp->data = value;
+    temp->next = NULL;
+
+    if (list == NULL) {
+        list = temp;
+    } else {
+        Node* cur = list;
+        while (cur->next != NULL) {
+            cur = cur->next;
         }
-        cout << endl;
+        cur->next = temp;
+    }
+}
+
+void freeGlobalList() {
+    while (list != NULL) {
+        Node* next = list->next;
+        delete list;
+        list = next;
+    }
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+The global-list build is O(n²): at 1M elements it would walk about 5*10^11
+nodes, so it runs at smaller n and its time is extrapolated with n².
+*/
+void benchmarkAppend() {
+    const int baselineSizes[] = {10000, 20000, 40000};
+    const int n = 1000000;
+
+    cout << "\nBuilding a list by appending n ints\n\n";
+    cout << "      n | Global list + walk | LinkedList push_back\n";
+    cout << "--------|--------------------|---------------------\n";
+
+    double perSquare = 0;
+    for (int size : baselineSizes) {
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < size; i++)
+            insert(i);
+        double walkTime = secondsSince(start);
+        freeGlobalList();
+        perSquare = walkTime / ((double)size * size);
+
+        LinkedList<int> ll;
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < size; i++)
+            ll.push_back(i);
+        double tailTime = secondsSince(start);
+
+        printf("%7d | %16.4f s | %17.4f s\n", size, walkTime, tailTime);
     }
 
+    LinkedList<int> ll;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+        ll.push_back(i);
+    double tailTime = secondsSince(start);
+    printf("%7d | %14.0f s * | %17.4f s\n", n, perSquare * n * n, tailTime);
+    cout << "(* extrapolated from the 40000-element run)\n";
+
+    long long sum = 0;
+    ll.forEach([&sum](int x) { sum += x; });
+    if (sum != (long long)n * (n - 1) / 2 || ll.size() != (size_t)n)
+        cout << "Error: list contents are wrong" << endl;
+}
+
+struct CycleTimes {
+    double build, traverse, destroy;
 };
 
-int main(){
+/*
+One "request": build a list of n ints, walk it once, throw it away.
+With the arena, throwing it away is clear() (nothing per node for int)
+plus one reset().
+*/
+template <typename Alloc>
+long long runCycles(int n, int cycles, Alloc alloc, NodeArena* arena, CycleTimes* t) {
+    long long checksum = 0;
+    t->build = t->traverse = t->destroy = 0;
+    for (int c = 0; c < cycles; c++) {
+        auto start = chrono::steady_clock::now();
+        LinkedList<int, Alloc>* ll = new LinkedList<int, Alloc>(alloc);
+        for (int i = 0; i < n; i++)
+            ll->push_back(i);
+        t->build += secondsSince(start);
+
+        start = chrono::steady_clock::now();
+        ll->forEach([&checksum](int x) { checksum += x; });
+        t->traverse += secondsSince(start);
 
-    List LL;
+        start = chrono::steady_clock::now();
+        delete ll;
+        if (arena != NULL)
+            arena->reset();
+        t->destroy += secondsSince(start);
+    }
+    return checksum;
+}
 
-    LL.insert(12);
-    LL.insert(21);
+void benchmarkArena() {
+    const int sizes[] = {100, 10000, 1000000};
+    const long long totalNodes = 20000000;
 
+    cout << "\nBuild / traverse / destroy cycles, ns per node\n\n";
+    cout << "  nodes/list |  Allocator | build | traverse | destroy | total\n";
+    cout << "-------------|------------|-------|----------|---------|------\n";
+
+    for (int n : sizes) {
+        int cycles = (int)(totalNodes / n);
+        double perNode = 1e9 / ((double)n * cycles);
+        CycleTimes heap, arena;
+
+        long long heapSum = runCycles(n, cycles, HeapAlloc(), NULL, &heap);
+        NodeArena nodeArena;
+        long long arenaSum = runCycles(n, cycles, ArenaAlloc(&nodeArena), &nodeArena, &arena);
+        if (heapSum != arenaSum)
+            cout << "Error: checksums differ" << endl;
+
+        printf("%12d | %10s | %5.2f | %8.2f | %7.2f | %5.2f\n", n, "new/delete",
+               heap.build * perNode, heap.traverse * perNode, heap.destroy * perNode,
+               (heap.build + heap.traverse + heap.destroy) * perNode);
+        printf("%12s | %10s | %5.2f | %8.2f | %7.2f | %5.2f\n", "", "arena",
+               arena.build * perNode, arena.traverse * perNode, arena.destroy * perNode,
+               (arena.build + arena.traverse + arena.destroy) * perNode);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    LinkedList<int> LL;
+
+    LL.push_back(12);
+    LL.push_back(21);
+    LL.push_front(5);
     LL.display();
+    cout << "size " << LL.size() << ", front " << LL.front() << ", back " << LL.back() << endl;
 
-    return 0;
+    LL.remove(21);              // Removing the tail moves tail back
+    LL.push_back(30);
+    LL.display();
+
+    // Independent lists, unlike the single global `list`
+    LinkedList<string> names;
+    names.push_back("ada");
+    names.push_back("linus");
+    LinkedList<string> copy = names;
+    copy.push_front("grace");
+    names.display();
+    copy.display();
+
+    // Nodes from an arena: one reset() frees them all
+    NodeArena arena;
+    {
+        LinkedList<int, ArenaAlloc> scratch((ArenaAlloc(&arena)));
+        for (int i = 1; i <= 5; i++)
+            scratch.push_back(i * i);
+        scratch.display();
+    }
+    cout << "arena holds " << arena.bytesReserved() << " bytes" << endl;
+    arena.reset();
 
-}
\ No newline at end of file
+    // ./linkedlist bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+        benchmarkAppend();
+        benchmarkArena();
+    }
+    return 0;
+}
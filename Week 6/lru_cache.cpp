@@ -0,0 +1,501 @@
+/*
+================================================================================
+LRU CACHE: CHAINED HASH TABLE + INTRUSIVE DOUBLY LINKED LIST
+================================================================================
+
+A cache keeps the most useful key -> value pairs in memory and throws out
+the Least Recently Used one when it is full. Both get and put must be O(1),
+so two structures share the same entries:
+
+  1. a separate-chaining hash table (openHashing.cpp, with the bucket
+     array, head insertion and doubling of openHashing_pooled.cpp) finds
+     an entry by key
+  2. a doubly linked recency list (doublyLinkedList_intrusive.cpp) keeps
+     the entries in use order, most recent first
+
+    buckets                       recency list (most recent first)
+    [0] -> (k7) -> NULL           head <-> (k3) <-> (k7) <-> (k1) <-> head
+    [1] -> NULL                             ^                   ^
+    [2] -> (k3) -> (k1) -> NULL        get/put moves here    evicted next
+    [3] -> NULL
+
+Each CacheEntry carries both links: `chainNext` for its bucket chain and a
+ListHook for the recency list, so an entry is one allocation and moving it
+to the front or evicting it never searches anything:
+
+    get(key):  find in chain -> moveToFront(entry)                 O(1)
+    put(key):  find or create -> moveToFront(entry)
+               while over capacity: evict back of the list         O(1) each
+
+Capacity is a number of entries, a number of bytes (key + value + entry
+overhead), or both; 0 means "no limit" for that one.
+
+Usage:
+    ./lru_cache                          demo
+    ./lru_cache gen warm.txt 100000      write 100000 "key value" lines
+    ./lru_cache warm warm.txt 50000      load a file into a 50000-entry cache
+    ./lru_cache bench [warm.txt]         Zipf-distributed read-through
+                                         workload (optionally warmed first)
+*/
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "intrusive_list.h"    // Recency list (doublyLinkedList_intrusive.cpp)
+using namespace std;
+
+//==============================================================================
+// CACHE
+//==============================================================================
+
+struct CacheEntry {
+    string key;
+    string value;
+    uint64_t hash;          // Kept so lookups and growing never rehash the key
+    CacheEntry* chainNext;  // Next entry in the same bucket
+    ListHook recency;       // Position in the recency list
+};
+
+const int INITIAL_BUCKETS = 16;     // Power of two
+
+struct LruCache {
+    CacheEntry** buckets;   // Head of each chain (NULL = empty bucket)
+    int bucketCount;        // Power of two
+    int shift;              // 64 - log2(bucketCount), used by bucketFor
+    IntrusiveList recency;  // Most recently used first
+    size_t entries;
+    size_t bytes;           // Sum of entryBytes() over all entries
+    size_t maxEntries;      // 0 = no limit
+    size_t maxBytes;        // 0 = no limit
+    long long hits, misses, evictions;
+};
+
+// What an entry costs against a byte capacity
+size_t entryBytes(const string& key, const string& value) {
+    return sizeof(CacheEntry) + key.size() + value.size();
+}
+
+// FNV-1a over the key's bytes
+uint64_t hashKey(const string& key) {
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < key.size(); i++) {
+        h ^= (unsigned char)key[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// Fibonacci hashing: keep the top bits of hash * 2^64/golden ratio
+int bucketFor(const LruCache* cache, uint64_t hash) {
+    if (cache->shift == 64) return 0;
+    return (int)((hash * 11400714819323198485ull) >> cache->shift);
+}
+
+void allocBuckets(LruCache* cache, int buckets) {
+    int count = 1, bits = 0;
+    while (count < buckets) {
+        count <<= 1;
+        bits++;
+    }
+    cache->buckets = new CacheEntry*[count];
+    for (int i = 0; i < count; i++)
+        cache->buckets[i] = NULL;
+    cache->bucketCount = count;
+    cache->shift = 64 - bits;
+}
+
+void initCache(LruCache* cache, size_t maxEntries, size_t maxBytes = 0) {
+    allocBuckets(cache, INITIAL_BUCKETS);
+    initList(&cache->recency);
+    cache->entries = 0;
+    cache->bytes = 0;
+    cache->maxEntries = maxEntries;
+    cache->maxBytes = maxBytes;
+    cache->hits = cache->misses = cache->evictions = 0;
+}
+
+// Re-links every entry into a table of at least `buckets` buckets
+void rehash(LruCache* cache, int buckets) {
+    CacheEntry** oldBuckets = cache->buckets;
+    int oldCount = cache->bucketCount;
+
+    allocBuckets(cache, buckets);
+    for (int i = 0; i < oldCount; i++) {
+        CacheEntry* curr = oldBuckets[i];
+        while (curr != NULL) {
+            CacheEntry* next = curr->chainNext;
+            int ind = bucketFor(cache, curr->hash);
+            curr->chainNext = cache->buckets[ind];
+            cache->buckets[ind] = curr;
+            curr = next;
+        }
+    }
+    delete[] oldBuckets;
+}
+
+// Sizes the table for `entries` keys up front, so a bulk load never regrows
+void reserveCache(LruCache* cache, size_t entries) {
+    if (entries > (size_t)cache->bucketCount && entries < (1u << 30))
+        rehash(cache, (int)entries);
+}
+
+void destroyCache(LruCache* cache) {
+    while (!isEmpty(&cache->recency)) {
+        CacheEntry* e = containerOf(cache->recency.head.next, CacheEntry, recency);
+        unlink(&e->recency);
+        delete e;
+    }
+    delete[] cache->buckets;
+    cache->buckets = NULL;
+    cache->entries = cache->bytes = 0;
+}
+
+CacheEntry* findEntry(const LruCache* cache, const string& key, uint64_t hash) {
+    CacheEntry* curr = cache->buckets[bucketFor(cache, hash)];
+    while (curr != NULL) {
+        if (curr->hash == hash && curr->key == key)
+            return curr;
+        curr = curr->chainNext;
+    }
+    return NULL;
+}
+
+// Unlinks an entry from its chain and the recency list (without freeing it)
+void detachEntry(LruCache* cache, CacheEntry* e) {
+    CacheEntry** link = &cache->buckets[bucketFor(cache, e->hash)];
+    while (*link != e)
+        link = &(*link)->chainNext;
+    *link = e->chainNext;
+
+    unlink(&e->recency);
+    cache->entries--;
+    cache->bytes -= entryBytes(e->key, e->value);
+}
+
+void removeEntry(LruCache* cache, CacheEntry* e) {
+    detachEntry(cache, e);
+    delete e;
+}
+
+bool overCapacity(const LruCache* cache) {
+    return (cache->maxEntries != 0 && cache->entries > cache->maxEntries) ||
+           (cache->maxBytes != 0 && cache->bytes > cache->maxBytes);
+}
+
+// Drops least recently used entries until the cache fits its limits
+void evict(LruCache* cache) {
+    while (overCapacity(cache) && !isEmpty(&cache->recency)) {
+        CacheEntry* lru = containerOf(cache->recency.head.prev, CacheEntry, recency);
+        removeEntry(cache, lru);
+        cache->evictions++;
+    }
+}
+
+// On a hit copies the value to *value and marks the key as most recent
+bool get(LruCache* cache, const string& key, string* value) {
+    CacheEntry* e = findEntry(cache, key, hashKey(key));
+    if (e == NULL) {
+        cache->misses++;
+        return false;
+    }
+    cache->hits++;
+    moveToFront(&cache->recency, &e->recency);
+    if (value != NULL)
+        *value = e->value;
+    return true;
+}
+
+/*
+Inserts or replaces key -> value as the most recent entry, evicting from
+the back if that puts the cache over capacity. Returns false (and stores
+nothing) if this one entry is bigger than the whole byte capacity.
+*/
+bool put(LruCache* cache, const string& key, const string& value) {
+    size_t size = entryBytes(key, value);
+    if (cache->maxBytes != 0 && size > cache->maxBytes)
+        return false;
+
+    uint64_t hash = hashKey(key);
+    CacheEntry* e = findEntry(cache, key, hash);
+    if (e != NULL) {
+        cache->bytes -= entryBytes(e->key, e->value);
+        e->value = value;
+        cache->bytes += size;
+        moveToFront(&cache->recency, &e->recency);
+        evict(cache);
+        return true;
+    }
+
+    if (cache->maxEntries != 0 && cache->entries == cache->maxEntries) {
+        /*
+        Full by entry count: the new key would evict the LRU entry anyway,
+        so reuse it in place. No delete/new, and key/value keep their
+        string buffers when the new contents fit.
+        */
+        e = containerOf(cache->recency.head.prev, CacheEntry, recency);
+        detachEntry(cache, e);
+        cache->evictions++;
+    } else {
+        if (cache->entries + 1 > (size_t)cache->bucketCount)
+            rehash(cache, cache->bucketCount * 2);
+        e = new CacheEntry;
+    }
+
+    e->key = key;
+    e->value = value;
+    e->hash = hash;
+    int ind = bucketFor(cache, hash);
+    e->chainNext = cache->buckets[ind];  // Head insertion: O(1)
+    cache->buckets[ind] = e;
+    pushFront(&cache->recency, &e->recency);
+    cache->entries++;
+    cache->bytes += size;
+    evict(cache);
+    return true;
+}
+
+bool remove(LruCache* cache, const string& key) {
+    CacheEntry* e = findEntry(cache, key, hashKey(key));
+    if (e == NULL)
+        return false;
+    removeEntry(cache, e);
+    return true;
+}
+
+void display(const LruCache* cache) {
+    cout << "[" << cache->entries << " entries, " << cache->bytes << " bytes] ";
+    for (ListHook* h = cache->recency.head.next; h != &cache->recency.head; h = h->next) {
+        CacheEntry* e = containerOf(h, CacheEntry, recency);
+        cout << e->key << "=" << e->value << " -> ";
+    }
+    cout << "NULL" << endl;
+}
+
+/*
+Bulk warm-up: each line is "key value" (the value is the rest of the line).
+Lines are loaded in file order, so with more lines than capacity the LAST
+ones stay cached - put the hottest keys at the end. Returns the number of
+lines loaded, or -1 if the file cannot be opened.
+*/
+long long warmFromFile(LruCache* cache, const char* path) {
+    ifstream in(path);
+    if (!in)
+        return -1;
+    if (cache->maxEntries != 0)
+        reserveCache(cache, cache->maxEntries);
+
+    long long loaded = 0;
+    string line, key, value;
+    while (getline(in, line)) {
+        size_t space = line.find(' ');
+        if (space == string::npos || space == 0)
+            continue;
+        key.assign(line, 0, space);
+        value.assign(line, space + 1, string::npos);
+        put(cache, key, value);
+        loaded++;
+    }
+    return loaded;
+}
+
+//==============================================================================
+// DEMO
+//==============================================================================
+
+void demo() {
+    LruCache cache;
+    initCache(&cache, 3);
+
+    put(&cache, "a", "apple");
+    put(&cache, "b", "banana");
+    put(&cache, "c", "cherry");
+    display(&cache);
+
+    string value;
+    get(&cache, "a", &value);      // a becomes most recent; b is now the LRU
+    cout << "get a = " << value << endl;
+    put(&cache, "d", "date");      // Over 3 entries: evicts b
+    display(&cache);
+    cout << "get b: " << (get(&cache, "b", &value) ? value : "miss") << endl;
+
+    put(&cache, "c", "coconut");   // Replace: c moves to the front
+    remove(&cache, "a");
+    display(&cache);
+    destroyCache(&cache);
+
+    // The same cache limited by bytes instead of entries
+    LruCache small;
+    initCache(&small, 0, 3 * sizeof(CacheEntry) + 20);
+    put(&small, "k1", "0123456789");
+    put(&small, "k2", "0123456789");
+    put(&small, "k3", "xy");       // Over the byte limit: evicts k1
+    display(&small);
+    cout << "hits " << small.hits << ", misses " << small.misses
+         << ", evictions " << small.evictions << endl;
+    destroyCache(&small);
+}
+
+//==============================================================================
+// BENCHMARK
+//==============================================================================
+
+const int KEY_SPACE = 1000000;
+
+string keyFor(int id) {
+    return "user:" + to_string(id);
+}
+
+// Values of 16..128 bytes, so the byte limit and the entry limit differ
+string valueFor(int id) {
+    string v = "profile-" + to_string(id) + "-";
+    v.resize(16 + (size_t)(id * 7919u) % 113, 'x');
+    return v;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+uint64_t nextRandom(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+// Writes the n hottest keys, coldest first, so they all survive a warm-up
+bool generateWarmFile(const char* path, int n) {
+    FILE* f = fopen(path, "w");
+    if (f == NULL)
+        return false;
+    for (int id = n - 1; id >= 0; id--)
+        fprintf(f, "%s %s\n", keyFor(id).c_str(), valueFor(id).c_str());
+    return fclose(f) == 0;
+}
+
+/*
+Key k (0 = hottest) is requested with probability proportional to
+1 / (k+1)^0.99, the usual skew of "hot lookups". The trace is drawn before
+timing; each request is a read-through: get, and on a miss "fetch" the
+value (a precomputed string) and put it.
+*/
+void benchmark(const char* warmPath) {
+    const int requests = 20000000;
+
+    string* keys = new string[KEY_SPACE];
+    string* values = new string[KEY_SPACE];
+    double* cdf = new double[KEY_SPACE];
+    double total = 0;
+    for (int k = 0; k < KEY_SPACE; k++) {
+        keys[k] = keyFor(k);
+        values[k] = valueFor(k);
+        total += 1.0 / pow(k + 1.0, 0.99);
+        cdf[k] = total;
+    }
+
+    int* trace = new int[requests];
+    uint64_t seed = 88172645463325252ull;
+    for (int i = 0; i < requests; i++) {
+        double u = (nextRandom(&seed) >> 11) * (1.0 / 9007199254740992.0) * total;
+        int lo = 0, hi = KEY_SPACE - 1;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (cdf[mid] < u) lo = mid + 1;
+            else hi = mid;
+        }
+        trace[i] = lo;
+    }
+
+    struct Config {
+        const char* name;
+        size_t maxEntries;
+        size_t maxBytes;
+    };
+    const Config configs[] = {
+        {"10K entries", 10000, 0},
+        {"100K entries", 100000, 0},
+        {"16 MB", 0, 16u << 20},
+    };
+
+    printf("\n%d requests over %d keys (Zipf 0.99), read-through\n", requests, KEY_SPACE);
+    if (warmPath != NULL)
+        printf("Each cache is warmed from %s first\n", warmPath);
+    printf("\n    Capacity  | Entries | Warm-up (s) | Hit rate | ns/op | Evictions\n");
+    printf("--------------|---------|-------------|----------|-------|----------\n");
+
+    for (const Config& config : configs) {
+        LruCache cache;
+        initCache(&cache, config.maxEntries, config.maxBytes);
+
+        double warmTime = 0;
+        if (warmPath != NULL) {
+            auto start = chrono::steady_clock::now();
+            if (warmFromFile(&cache, warmPath) < 0) {
+                cout << "Cannot read " << warmPath << endl;
+                return;
+            }
+            warmTime = secondsSince(start);
+            cache.hits = cache.misses = cache.evictions = 0;
+        }
+
+        string value;
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < requests; i++) {
+            int id = trace[i];
+            if (!get(&cache, keys[id], &value))
+                put(&cache, keys[id], values[id]);
+        }
+        double elapsed = secondsSince(start);
+
+        printf("%13s | %7zu | %11.3f | %7.2f%% | %5.1f | %lld\n", config.name, cache.entries,
+               warmTime, 100.0 * cache.hits / requests, elapsed * 1e9 / requests, cache.evictions);
+        destroyCache(&cache);
+    }
+
+    delete[] trace;
+    delete[] cdf;
+    delete[] values;
+    delete[] keys;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc >= 4 && strcmp(argv[1], "gen") == 0) {
+        if (!generateWarmFile(argv[2], atoi(argv[3]))) {
+            cout << "Cannot write " << argv[2] << endl;
+            return 1;
+        }
+        return 0;
+    }
+    if (argc >= 4 && strcmp(argv[1], "warm") == 0) {
+        LruCache cache;
+        initCache(&cache, (size_t)atoll(argv[3]));
+        auto start = chrono::steady_clock::now();
+        long long loaded = warmFromFile(&cache, argv[2]);
+        double elapsed = secondsSince(start);
+        if (loaded < 0) {
+            cout << "Cannot read " << argv[2] << endl;
+            return 1;
+        }
+        printf("Loaded %lld lines in %.3f s (%.0f ns/line): %zu entries, %zu bytes\n",
+               loaded, elapsed, loaded > 0 ? elapsed * 1e9 / loaded : 0.0,
+               cache.entries, cache.bytes);
+        destroyCache(&cache);
+        return 0;
+    }
+    if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+        benchmark(argc > 2 ? argv[2] : NULL);
+        return 0;
+    }
+
+    demo();
+    return 0;
+}
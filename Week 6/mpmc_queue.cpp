@@ -0,0 +1,436 @@
+/*
+================================================================================
+BOUNDED MPMC QUEUE (PER-SLOT SEQUENCE NUMBERS)
+================================================================================
+
+THE PROBLEM WITH A SHARED count
+-------------------------------
+CircularQueue<T> (circular_queue.cpp) decides full/empty from one `count`
+field. With several producers and consumers every operation would have to
+update that one int, so the only safe option is a mutex around the whole
+queue, and then only one thread at a time makes progress.
+
+SPSC (spsc_ring_queue.cpp) avoids the lock by giving each index a single
+writer - that no longer works with many producers and many consumers.
+
+IDEA (Dmitry Vyukov's bounded MPMC queue)
+-----------------------------------------
+Keep the same array of slots, but give EVERY SLOT its own sequence number
+instead of having one shared count:
+
+    struct Slot { atomic<size_t> sequence; T value; };
+
+    capacity = 4, initially slot i has sequence = i
+
+    enqueuePos = 0                dequeuePos = 0
+      [seq 0 | _ ][seq 1 | _ ][seq 2 | _ ][seq 3 | _ ]
+
+A producer at position pos looks at slot pos & mask:
+  - sequence == pos      -> slot is free for round pos; claim pos with a
+                            compare-and-swap on enqueuePos, write the value,
+                            then set sequence = pos + 1 ("filled")
+  - sequence <  pos      -> the slot still holds last round's value: FULL
+  - sequence >  pos      -> another producer took pos; reload and retry
+
+A consumer at position pos looks at the same slot:
+  - sequence == pos + 1  -> filled; claim pos with a CAS on dequeuePos,
+                            read the value, then set
+                            sequence = pos + capacity ("free for next round")
+  - sequence <  pos + 1  -> not filled yet: EMPTY
+  - sequence >  pos + 1  -> another consumer took pos; reload and retry
+
+After enqueue(a), enqueue(b), dequeue():
+
+    enqueuePos = 2                dequeuePos = 1
+      [seq 4 | _ ][seq 2 | b ][seq 2 | _ ][seq 3 | _ ]
+       free for   filled       free for     free for
+       pos 4      (pos 1)      pos 2        pos 3
+
+Producers only contend with producers (on enqueuePos) and consumers with
+consumers (on dequeuePos); a producer and a consumer only meet at a slot
+when the queue is nearly full or nearly empty.
+
+Compile: g++ -std=c++17 -O2 -pthread mpmc_queue.cpp
+Benchmark: ./a.out bench
+*/
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+using namespace std;
+
+//==============================================================================
+// MPMC QUEUE STRUCTURE
+//==============================================================================
+
+const size_t CACHE_LINE = 64;
+
+template <typename T>
+struct MpmcSlot {
+    atomic<size_t> sequence;  // Which round/state this slot is in
+    T value;
+};
+
+template <typename T>
+struct MpmcQueue {
+    alignas(CACHE_LINE) MpmcSlot<T>* slots;  // Like CircularQueue::arr
+    size_t capacity;                         // Power of two
+    size_t mask;                             // capacity - 1
+
+    alignas(CACHE_LINE) atomic<size_t> enqueuePos;  // Like rear + 1, never wrapped
+    alignas(CACHE_LINE) atomic<size_t> dequeuePos;  // Like front, never wrapped
+};
+
+//==============================================================================
+// INITIALIZATION / CLEANUP
+//==============================================================================
+
+// Capacity is rounded up to a power of two (at least 2)
+template <typename T>
+void initMpmcQueue(MpmcQueue<T>* queue, size_t capacity) {
+    size_t cap = 2;
+    while (cap < capacity)
+        cap <<= 1;
+
+    queue->slots = new MpmcSlot<T>[cap];
+    for (size_t i = 0; i < cap; i++)
+        queue->slots[i].sequence.store(i, memory_order_relaxed);
+    queue->capacity = cap;
+    queue->mask = cap - 1;
+    queue->enqueuePos.store(0, memory_order_relaxed);
+    queue->dequeuePos.store(0, memory_order_relaxed);
+}
+
+// Call after every thread using the queue has been joined
+template <typename T>
+void destroyMpmcQueue(MpmcQueue<T>* queue) {
+    delete[] queue->slots;
+    queue->slots = nullptr;
+}
+
+//==============================================================================
+// ENQUEUE / DEQUEUE
+//==============================================================================
+
+/*
+ENQUEUE - any number of threads
+Returns false if the queue is full (like CircularQueue's enqueue()).
+Lock-free: a thread only retries when another thread made progress.
+*/
+template <typename T>
+bool enqueue(MpmcQueue<T>* queue, const T& value) {
+    size_t pos = queue->enqueuePos.load(memory_order_relaxed);
+    MpmcSlot<T>* slot;
+
+    while (true) {
+        slot = &queue->slots[pos & queue->mask];
+        size_t seq = slot->sequence.load(memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            // Free for this round: try to claim pos
+            if (queue->enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                break;
+            // CAS failed: pos now holds the current enqueuePos, retry
+        } else if (diff < 0) {
+            return false;  // Slot not consumed since last round: full
+        } else {
+            pos = queue->enqueuePos.load(memory_order_relaxed);  // Lost the race
+        }
+    }
+
+    slot->value = value;
+    slot->sequence.store(pos + 1, memory_order_release);  // Mark filled
+    return true;
+}
+
+/*
+DEQUEUE - any number of threads
+Returns false if the queue is empty, otherwise stores the element in *value.
+*/
+template <typename T>
+bool dequeue(MpmcQueue<T>* queue, T* value) {
+    size_t pos = queue->dequeuePos.load(memory_order_relaxed);
+    MpmcSlot<T>* slot;
+
+    while (true) {
+        slot = &queue->slots[pos & queue->mask];
+        size_t seq = slot->sequence.load(memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0) {
+            // Filled: try to claim pos
+            if (queue->dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return false;  // Not filled yet: empty
+        } else {
+            pos = queue->dequeuePos.load(memory_order_relaxed);
+        }
+    }
+
+    *value = slot->value;
+    slot->sequence.store(pos + queue->capacity, memory_order_release);  // Free for next round
+    return true;
+}
+
+//==============================================================================
+// HELPER FUNCTIONS (APPROXIMATE)
+//==============================================================================
+
+/*
+With other threads running, any size is out of date as soon as it is
+read: treat these as hints (monitoring, back-off decisions), never as a
+guarantee that the next enqueue/dequeue will succeed - check their return
+values instead.
+
+The two positions are read separately, so a dequeue can appear to
+overtake an enqueue; the result is clamped to [0, capacity].
+*/
+template <typename T>
+size_t size(MpmcQueue<T>* queue) {
+    size_t dequeued = queue->dequeuePos.load(memory_order_acquire);
+    size_t enqueued = queue->enqueuePos.load(memory_order_acquire);
+    if (enqueued <= dequeued)
+        return 0;
+    size_t n = enqueued - dequeued;
+    return n > queue->capacity ? queue->capacity : n;
+}
+
+template <typename T>
+bool isEmpty(MpmcQueue<T>* queue) {
+    return size(queue) == 0;
+}
+
+template <typename T>
+bool isFull(MpmcQueue<T>* queue) {
+    return size(queue) == queue->capacity;
+}
+
+//==============================================================================
+// BASELINE: CircularQueue (circular_queue.cpp) BEHIND ONE MUTEX
+//==============================================================================
+
+template <typename T>
+struct CircularQueue {
+    T* arr;
+    int front;
+    int rear;
+    int capacity;
+    int count;
+};
+
+template <typename T>
+void initCircularQueue(CircularQueue<T>* queue, int capacity) {
+    queue->arr = new T[capacity];
+    queue->capacity = capacity;
+    queue->front = 0;
+    queue->rear = -1;
+    queue->count = 0;
+}
+
+template <typename T>
+void destroyCircularQueue(CircularQueue<T>* queue) {
+    delete[] queue->arr;
+    queue->arr = nullptr;
+}
+
+template <typename T>
+struct LockedQueue {
+    CircularQueue<T> queue;
+    mutex lock;
+};
+
+template <typename T>
+bool enqueue(LockedQueue<T>* locked, const T& value) {
+    lock_guard<mutex> guard(locked->lock);
+    CircularQueue<T>* queue = &locked->queue;
+    if (queue->count == queue->capacity)
+        return false;
+    queue->rear = (queue->rear + 1) % queue->capacity;
+    queue->arr[queue->rear] = value;
+    queue->count++;
+    return true;
+}
+
+template <typename T>
+bool dequeue(LockedQueue<T>* locked, T* value) {
+    lock_guard<mutex> guard(locked->lock);
+    CircularQueue<T>* queue = &locked->queue;
+    if (queue->count == 0)
+        return false;
+    *value = queue->arr[queue->front];
+    queue->front = (queue->front + 1) % queue->capacity;
+    queue->count--;
+    return true;
+}
+
+//==============================================================================
+// DEMONSTRATION
+//==============================================================================
+
+void demonstrateMpmcQueue() {
+    cout << "\n====================================================\n";
+    cout << "  BOUNDED MPMC QUEUE DEMONSTRATION\n";
+    cout << "====================================================\n\n";
+
+    MpmcQueue<int> queue;
+    initMpmcQueue(&queue, 4);
+
+    cout << "1. Enqueuing 10, 20, 30, 40, 50 (capacity 4):\n   ";
+    for (int v = 10; v <= 50; v += 10)
+        cout << v << (enqueue(&queue, v) ? " ok  " : " FULL  ");
+    cout << "\n   Size: " << size(&queue) << ", isFull: " << isFull(&queue) << endl;
+
+    int value;
+    dequeue(&queue, &value);
+    cout << "\n2. Dequeued " << value << "; slot sequences now: ";
+    for (size_t i = 0; i < queue.capacity; i++)
+        cout << queue.slots[i].sequence.load() << " ";
+    cout << "\n   (slot 0 is free for position 4, slots 1-3 are filled)\n";
+    while (dequeue(&queue, &value)) {}
+    destroyMpmcQueue(&queue);
+
+    // 4 producers and 4 consumers share one small queue
+    const int producers = 4, consumers = 4, perProducer = 50000;
+    initMpmcQueue(&queue, 64);
+    atomic<long long> sum(0);
+    atomic<int> received(0);
+    vector<thread> threads;
+
+    for (int p = 0; p < producers; p++) {
+        threads.push_back(thread([&queue, p]() {
+            for (int i = 1; i <= perProducer; i++) {
+                while (!enqueue(&queue, p * perProducer + i))
+                    this_thread::yield();
+            }
+        }));
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.push_back(thread([&queue, &sum, &received]() {
+            int v;
+            while (received.load(memory_order_relaxed) < producers * perProducer) {
+                if (dequeue(&queue, &v)) {
+                    sum.fetch_add(v, memory_order_relaxed);
+                    received.fetch_add(1, memory_order_relaxed);
+                } else {
+                    this_thread::yield();
+                }
+            }
+        }));
+    }
+    for (thread& t : threads) t.join();
+
+    long long total = (long long)producers * perProducer;
+    cout << "\n3. " << producers << " producers x " << perProducer << " values, "
+         << consumers << " consumers:\n";
+    cout << "   Received " << received.load() << ", sum " << sum.load()
+         << " (expected " << total * (total + 1) / 2 << ")\n";
+    destroyMpmcQueue(&queue);
+}
+
+//==============================================================================
+// BENCHMARK
+//==============================================================================
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+Half the threads produce, half consume; `totalOps` values pass through a
+1024-slot queue. Works for either queue type thanks to the overloaded
+enqueue()/dequeue(). Returns millions of transfers per second.
+*/
+template <typename Queue>
+double runTransfer(Queue* queue, int threads, int totalOps) {
+    int producers = threads / 2, consumers = threads - producers;
+    int perProducer = totalOps / producers;
+    long long expected = (long long)perProducer * producers;
+    atomic<long long> received(0);
+    atomic<long long> checksum(0);
+    vector<thread> workers;
+
+    auto start = chrono::steady_clock::now();
+    for (int p = 0; p < producers; p++) {
+        workers.push_back(thread([queue, perProducer]() {
+            for (int i = 1; i <= perProducer; i++) {
+                while (!enqueue(queue, i))
+                    this_thread::yield();
+            }
+        }));
+    }
+    for (int c = 0; c < consumers; c++) {
+        workers.push_back(thread([queue, expected, &received, &checksum]() {
+            long long local = 0, count = 0;
+            int v;
+            while (received.load(memory_order_relaxed) < expected) {
+                if (dequeue(queue, &v)) {
+                    local += v;
+                    count++;
+                    if ((count & 255) == 0) {  // Publish progress in batches
+                        received.fetch_add(256, memory_order_relaxed);
+                        count = 0;
+                    }
+                } else {
+                    received.fetch_add(count, memory_order_relaxed);
+                    count = 0;
+                    this_thread::yield();
+                }
+            }
+            received.fetch_add(count, memory_order_relaxed);
+            checksum.fetch_add(local, memory_order_relaxed);
+        }));
+    }
+    for (thread& w : workers) w.join();
+    double elapsed = secondsSince(start);
+
+    if (checksum.load() != (long long)producers * perProducer * (perProducer + 1LL) / 2)
+        cout << "Error: lost or duplicated values" << endl;
+    return expected / elapsed / 1e6;
+}
+
+void benchmark() {
+    const int threadCounts[] = {2, 4, 8, 16, 32};
+    const int totalOps = 4000000;
+    const int capacity = 1024;
+
+    cout << "\nHardware threads: " << thread::hardware_concurrency() << "\n";
+    cout << totalOps << " values through a " << capacity
+         << "-slot queue, half producers / half consumers (M transfers/sec)\n\n";
+    cout << "Threads | Mutex + CircularQueue | MPMC sequence slots\n";
+    cout << "--------|-----------------------|--------------------\n";
+
+    for (int threads : threadCounts) {
+        LockedQueue<int> locked;
+        initCircularQueue(&locked.queue, capacity);
+        double lockedRate = runTransfer(&locked, threads, totalOps);
+        destroyCircularQueue(&locked.queue);
+
+        MpmcQueue<int> mpmc;
+        initMpmcQueue(&mpmc, capacity);
+        double mpmcRate = runTransfer(&mpmc, threads, totalOps);
+        destroyMpmcQueue(&mpmc);
+
+        printf("%7d | %21.2f | %19.2f\n", threads, lockedRate, mpmcRate);
+    }
+}
+
+//==============================================================================
+// MAIN FUNCTION
+//==============================================================================
+
+int main(int argc, char* argv[]) {
+    demonstrateMpmcQueue();
+
+    // ./mpmc_queue bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
+    return 0;
+}
@@ -0,0 +1,391 @@
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+using namespace std;
+
+/*
+POOLED SEPARATE CHAINING
+------------------------
+openHashing.cpp has two costs on every collision:
+  1. `new Node()` - one trip to the allocator per key, and the nodes end
+     up scattered all over the heap
+  2. it walks to the END of the chain to append, so inserting into a
+     bucket that already has k keys costs O(k)
+
+This version fixes both:
+  - nodes come from a pool: big slabs of 4096 nodes, handed out one by
+    one (a pointer bump); removed nodes go on a free list for reuse
+  - new keys go at the HEAD of the chain: O(1) no matter how long it is
+  - the bucket count doubles when keys/buckets passes maxLoad, so chains
+    stay short on average; growing re-links the existing nodes and
+    allocates no new ones
+
+Like openHashing.cpp, inserting the same key twice stores it twice.
+*/
+
+struct Node {
+    int data;
+    Node* next;
+};
+
+// Calls to new/new[] (nodes, slabs and bucket arrays), counted the same
+// way in both tables
+long long allocations = 0;
+
+//==============================================================================
+// NODE POOL (SLAB ALLOCATOR)
+//==============================================================================
+
+const int SLAB_NODES = 4096;
+
+struct Slab {
+    Node nodes[SLAB_NODES];
+    Slab* next;          // All slabs are kept in a list so we can free them
+};
+
+struct NodePool {
+    Slab* slabs;         // Most recent slab first
+    int used;            // Nodes handed out from slabs->nodes
+    Node* freeList;      // Nodes returned by poolFree, linked through next
+};
+
+void initPool(NodePool* pool) {
+    pool->slabs = NULL;
+    pool->used = SLAB_NODES;  // Forces a slab allocation on first use
+    pool->freeList = NULL;
+}
+
+Node* poolAlloc(NodePool* pool) {
+    if (pool->freeList != NULL) {
+        Node* node = pool->freeList;
+        pool->freeList = node->next;
+        return node;
+    }
+    if (pool->used == SLAB_NODES) {
+        Slab* slab = new Slab;
+        allocations++;
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+        pool->used = 0;
+    }
+    return &pool->slabs->nodes[pool->used++];
+}
+
+void poolFree(NodePool* pool, Node* node) {
+    node->next = pool->freeList;
+    pool->freeList = node;
+}
+
+// Frees every node at once - one delete per slab, not per node
+void destroyPool(NodePool* pool) {
+    while (pool->slabs != NULL) {
+        Slab* next = pool->slabs->next;
+        delete pool->slabs;
+        pool->slabs = next;
+    }
+    initPool(pool);
+}
+
+//==============================================================================
+// CHAINED HASH TABLE
+//==============================================================================
+
+const int INITIAL_BUCKETS = 16;       // Power of two
+const double MAX_LOAD_FACTOR = 1.0;   // Average chain length before growing
+
+struct ChainedHashTable {
+    Node** buckets;      // Head of each chain (NULL = empty bucket)
+    int bucketCount;     // Power of two
+    int shift;           // 64 - log2(bucketCount), used by bucketFor
+    int size;
+    double maxLoad;
+    NodePool pool;
+};
+
+void initTable(ChainedHashTable* ht, int buckets = INITIAL_BUCKETS,
+               double maxLoad = MAX_LOAD_FACTOR) {
+    int count = 1, bits = 0;
+    while (count < buckets) {
+        count <<= 1;
+        bits++;
+    }
+    ht->buckets = new Node*[count];
+    allocations++;
+    for (int i = 0; i < count; i++)
+        ht->buckets[i] = NULL;
+    ht->bucketCount = count;
+    ht->shift = 64 - bits;
+    ht->size = 0;
+    ht->maxLoad = maxLoad;
+    initPool(&ht->pool);
+}
+
+void destroyTable(ChainedHashTable* ht) {
+    delete[] ht->buckets;
+    ht->buckets = NULL;
+    ht->size = 0;
+    destroyPool(&ht->pool);
+}
+
+// Fibonacci hashing: keep the top bits of key * 2^64/golden ratio
+int bucketFor(const ChainedHashTable* ht, int key) {
+    if (ht->shift == 64) return 0;
+    return (int)(((uint64_t)(uint32_t)key * 11400714819323198485ull) >> ht->shift);
+}
+
+// Double the bucket array and move every node to its new chain
+void grow(ChainedHashTable* ht) {
+    Node** oldBuckets = ht->buckets;
+    int oldCount = ht->bucketCount;
+
+    ht->bucketCount *= 2;
+    ht->shift--;
+    ht->buckets = new Node*[ht->bucketCount];
+    allocations++;
+    for (int i = 0; i < ht->bucketCount; i++)
+        ht->buckets[i] = NULL;
+
+    for (int i = 0; i < oldCount; i++) {
+        Node* curr = oldBuckets[i];
+        while (curr != NULL) {
+            Node* next = curr->next;
+            int ind = bucketFor(ht, curr->data);
+            curr->next = ht->buckets[ind];
+            ht->buckets[ind] = curr;
+            curr = next;
+        }
+    }
+    delete[] oldBuckets;
+}
+
+void insert(ChainedHashTable* ht, int value) {
+    if (ht->size + 1 > ht->maxLoad * ht->bucketCount)
+        grow(ht);
+
+    int ind = bucketFor(ht, value);
+    Node* temp = poolAlloc(&ht->pool);
+    temp->data = value;
+    temp->next = ht->buckets[ind];  // Head insertion: O(1)
+    ht->buckets[ind] = temp;
+    ht->size++;
+}
+
+bool search(const ChainedHashTable* ht, int value) {
+    Node* curr = ht->buckets[bucketFor(ht, value)];
+    while (curr != NULL) {
+        if (curr->data == value)
+            return true;
+        curr = curr->next;
+    }
+    return false;
+}
+
+// Removes one copy of value; its node goes back to the pool
+bool remove(ChainedHashTable* ht, int value) {
+    Node** link = &ht->buckets[bucketFor(ht, value)];
+    while (*link != NULL) {
+        if ((*link)->data == value) {
+            Node* dead = *link;
+            *link = dead->next;
+            poolFree(&ht->pool, dead);
+            ht->size--;
+            return true;
+        }
+        link = &(*link)->next;
+    }
+    return false;
+}
+
+void display(const ChainedHashTable* ht) {
+    for (int i = 0; i < ht->bucketCount; i++) {
+        cout << i << " : ";
+        Node* curr = ht->buckets[i];
+        while (curr != NULL) {
+            cout << curr->data << " -> ";
+            curr = curr->next;
+        }
+        cout << "NULL" << endl;
+    }
+}
+
+//==============================================================================
+// BASELINE: THE openHashing.cpp DESIGN
+//==============================================================================
+
+/*
+Same layout as openHashing.cpp (first key stored in the bucket array,
+collisions appended at the tail with `new Node`) but with a configurable,
+fixed bucket count: with only 10 buckets, 1M keys would need ~5*10^10
+chain steps.
+*/
+struct BaselineTable {
+    Node* HT;
+    int bucketCount;
+};
+
+void initBaseline(BaselineTable* bt, int buckets) {
+    bt->HT = new Node[buckets];
+    allocations++;
+    bt->bucketCount = buckets;
+    for (int i = 0; i < buckets; i++) {
+        bt->HT[i].data = -1;
+        bt->HT[i].next = NULL;
+    }
+}
+
+void baselineInsert(BaselineTable* bt, int value) {
+    int ind = value % bt->bucketCount;
+    if (bt->HT[ind].data == -1) {
+        bt->HT[ind].data = value;
+        return;
+    }
+    Node* temp = new Node;
+    allocations++;
+    temp->data = value;
+    temp->next = NULL;
+
+    if (bt->HT[ind].next == NULL) {
+        bt->HT[ind].next = temp;
+        return;
+    }
+    Node* curr = bt->HT[ind].next;
+    while (curr->next != NULL)  // Walk to the tail: O(chain length)
+        curr = curr->next;
+    curr->next = temp;
+}
+
+bool baselineSearch(const BaselineTable* bt, int value) {
+    int ind = value % bt->bucketCount;
+    if (bt->HT[ind].data == -1) return false;
+    if (bt->HT[ind].data == value) return true;
+    Node* curr = bt->HT[ind].next;
+    while (curr != NULL) {
+        if (curr->data == value) return true;
+        curr = curr->next;
+    }
+    return false;
+}
+
+void destroyBaseline(BaselineTable* bt) {
+    for (int i = 0; i < bt->bucketCount; i++) {
+        Node* curr = bt->HT[i].next;
+        while (curr != NULL) {
+            Node* next = curr->next;
+            delete curr;
+            curr = next;
+        }
+    }
+    delete[] bt->HT;
+}
+
+//==============================================================================
+// BENCHMARK
+//==============================================================================
+
+uint64_t nextRandom(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+void benchmark() {
+    const int n = 1000000;
+    const int baselineBuckets = 1 << 16;
+    int* keys = new int[n];
+    uint64_t state = 0x2545F4914F6CDD1Dull;
+    for (int i = 0; i < n; i++)
+        keys[i] = (int)(nextRandom(&state) & 0x7FFFFFFF);
+
+    cout << "\n" << n << " random keys\n";
+    cout << "Table                      | Insert s | Lookup s | new calls\n";
+    cout << "---------------------------|----------|----------|----------\n";
+
+    // Baseline
+    BaselineTable bt;
+    allocations = 0;
+    initBaseline(&bt, baselineBuckets);
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+        baselineInsert(&bt, keys[i]);
+    double insertTime = secondsSince(start);
+    int found = 0;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+        found += baselineSearch(&bt, keys[i]);
+    double lookupTime = secondsSince(start);
+    printf("Baseline (%5d buckets)   | %8.3f | %8.3f | %lld\n",
+           baselineBuckets, insertTime, lookupTime, allocations);
+    destroyBaseline(&bt);
+
+    // Pooled
+    ChainedHashTable ht;
+    allocations = 0;
+    initTable(&ht);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+        insert(&ht, keys[i]);
+    insertTime = secondsSince(start);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+        found += search(&ht, keys[i]);
+    lookupTime = secondsSince(start);
+    printf("Pooled (grew to %7d)   | %8.3f | %8.3f | %lld\n",
+           ht.bucketCount, insertTime, lookupTime, allocations);
+    destroyTable(&ht);
+
+    if (found != 2 * n)
+        cout << "Error: only " << found << " of " << 2 * n << " lookups succeeded" << endl;
+
+    // Hot bucket: every insert lands in the same chain
+    const int hot = 20000;
+    initBaseline(&bt, baselineBuckets);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < hot; i++)
+        baselineInsert(&bt, 7);
+    double baselineHot = secondsSince(start);
+    destroyBaseline(&bt);
+
+    initTable(&ht);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < hot; i++)
+        insert(&ht, 7);
+    double pooledHot = secondsSince(start);
+    destroyTable(&ht);
+
+    printf("\nHot bucket (%d inserts into one chain): baseline %.4f s, pooled %.4f s\n",
+           hot, baselineHot, pooledHot);
+
+    delete[] keys;
+}
+
+int main(int argc, char* argv[]) {
+    ChainedHashTable ht;
+    initTable(&ht, 8);
+
+    insert(&ht, 90);
+    insert(&ht, 41);
+    insert(&ht, 71);
+    insert(&ht, 61);
+    insert(&ht, 22);
+    cout << search(&ht, 90) << endl;
+    display(&ht);
+
+    remove(&ht, 71);
+    insert(&ht, 33);  // Reuses 71's node from the free list
+    display(&ht);
+    destroyTable(&ht);
+
+    // ./openHashing_pooled bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
+    return 0;
+}
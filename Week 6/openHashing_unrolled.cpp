@@ -0,0 +1,284 @@
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+using namespace std;
+
+/*
+UNROLLED (BUCKETIZED) CHAINING
+------------------------------
+In openHashing.cpp / test.cpp every chain element is its own Node:
+
+    HT[3]: [15|•]→[25|•]→[35|•]→[45|NULL]
+
+Each arrow is a pointer to somewhere else on the heap, so searching a
+chain of k keys costs up to k cache misses (~100 ns each).
+
+Here each chain link is a Block that fills exactly one 64-byte cache line:
+
+    +--------------------------------------------+-------+------+
+    | keys[0] keys[1] ... keys[12]   (13 ints)   | count | next |
+    +--------------------------------------------+-------+------+
+      52 bytes                                     4       8     = 64
+
+    HT[3]: [15 25 35 45 _ _ _ _ _ _ _ _ _ | 4 | NULL]
+
+A chain of up to 13 keys is ONE cache miss, scanned as a plain array.
+The first block of each bucket lives inside the bucket array itself, like
+`Node hashTable[10]` stores the first node inline.
+
+Insert always writes into the bucket's inline block. When it is full its
+contents move into a new block linked behind it, and it starts empty
+again, so insert is O(1) and never walks the chain.
+
+Compile with -std=c++17 so `new Block` honours the 64-byte alignment.
+*/
+
+const int KEYS_PER_BLOCK = 13;
+
+struct alignas(64) Block {
+    int keys[KEYS_PER_BLOCK];
+    int count;           // Keys used in this block
+    Block* next;         // Older, full blocks
+};
+
+static_assert(sizeof(Block) == 64, "Block should fill one cache line");
+
+struct UnrolledHashTable {
+    Block* HT;           // Bucket array: one inline block per bucket
+    int bucketCount;
+    int size;
+};
+
+void initTable(UnrolledHashTable* ht, int buckets) {
+    ht->HT = new Block[buckets];
+    ht->bucketCount = buckets;
+    ht->size = 0;
+    for (int i = 0; i < buckets; i++) {
+        ht->HT[i].count = 0;
+        ht->HT[i].next = NULL;
+    }
+}
+
+void destroyTable(UnrolledHashTable* ht) {
+    for (int i = 0; i < ht->bucketCount; i++) {
+        Block* curr = ht->HT[i].next;
+        while (curr != NULL) {
+            Block* next = curr->next;
+            delete curr;
+            curr = next;
+        }
+    }
+    delete[] ht->HT;
+    ht->HT = NULL;
+}
+
+// value % bucketCount is negative for a negative key; reducing the key as
+// unsigned always gives a bucket in [0, bucketCount)
+int bucketFor(const UnrolledHashTable* ht, int value) {
+    return (int)((unsigned int)value % (unsigned int)ht->bucketCount);
+}
+
+void insert(UnrolledHashTable* ht, int value) {
+    Block* head = &ht->HT[bucketFor(ht, value)];
+
+    if (head->count == KEYS_PER_BLOCK) {
+        // Move the full inline block out to the heap and start over
+        Block* full = new Block(*head);
+        head->next = full;
+        head->count = 0;
+    }
+    head->keys[head->count++] = value;
+    ht->size++;
+}
+
+bool search(const UnrolledHashTable* ht, int value) {
+    const Block* curr = &ht->HT[bucketFor(ht, value)];
+    while (curr != NULL) {
+        for (int i = 0; i < curr->count; i++) {
+            if (curr->keys[i] == value)
+                return true;
+        }
+        curr = curr->next;
+    }
+    return false;
+}
+
+void display(const UnrolledHashTable* ht) {
+    for (int i = 0; i < ht->bucketCount; i++) {
+        cout << i << " : ";
+        const Block* curr = &ht->HT[i];
+        while (curr != NULL) {
+            cout << "[ ";
+            for (int k = 0; k < curr->count; k++)
+                cout << curr->keys[k] << " ";
+            cout << "] -> ";
+            curr = curr->next;
+        }
+        cout << "NULL" << endl;
+    }
+}
+
+//==============================================================================
+// BASELINE: ONE INT PER NODE (test.cpp LAYOUT)
+//==============================================================================
+
+struct Node {
+    int data;
+    Node* next;
+};
+
+struct NodeHashTable {
+    Node* HT;
+    int bucketCount;
+};
+
+void initNodeTable(NodeHashTable* nt, int buckets) {
+    nt->HT = new Node[buckets];
+    nt->bucketCount = buckets;
+    for (int i = 0; i < buckets; i++) {
+        nt->HT[i].data = -1;
+        nt->HT[i].next = NULL;
+    }
+}
+
+void nodeInsert(NodeHashTable* nt, int value) {
+    int ind = (int)((unsigned int)value % (unsigned int)nt->bucketCount);
+    if (nt->HT[ind].data == -1) {
+        nt->HT[ind].data = value;
+        return;
+    }
+    Node* temp = new Node;
+    temp->data = value;
+    temp->next = NULL;
+    if (nt->HT[ind].next == NULL) {
+        nt->HT[ind].next = temp;
+        return;
+    }
+    Node* curr = nt->HT[ind].next;
+    while (curr->next != NULL)
+        curr = curr->next;
+    curr->next = temp;
+}
+
+bool nodeSearch(const NodeHashTable* nt, int value) {
+    int ind = (int)((unsigned int)value % (unsigned int)nt->bucketCount);
+    if (nt->HT[ind].data == -1) return false;
+    if (nt->HT[ind].data == value) return true;
+    Node* curr = nt->HT[ind].next;
+    while (curr != NULL) {
+        if (curr->data == value) return true;
+        curr = curr->next;
+    }
+    return false;
+}
+
+void destroyNodeTable(NodeHashTable* nt) {
+    for (int i = 0; i < nt->bucketCount; i++) {
+        Node* curr = nt->HT[i].next;
+        while (curr != NULL) {
+            Node* next = curr->next;
+            delete curr;
+            curr = next;
+        }
+    }
+    delete[] nt->HT;
+}
+
+//==============================================================================
+// BENCHMARK
+//==============================================================================
+
+uint64_t nextRandom(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+Both tables use the same bucket count and the same `value % buckets`
+mapping, so they hold identical chains; only the memory layout differs.
+Chain length L = keys / buckets. Hits search for stored keys (scan about
+half a chain), misses for absent keys (scan the whole chain).
+*/
+void benchmark() {
+    const int buckets = 1 << 16;
+    const int lengths[] = {1, 2, 4, 8, 16, 32};
+    const int lookups = 1000000;
+
+    int maxKeys = buckets * 32;
+    int* keys = new int[maxKeys];
+    uint64_t state = 88172645463325252ull;
+    for (int i = 0; i < maxKeys; i++)
+        keys[i] = (int)(nextRandom(&state) & 0x3FFFFFFF);  // Bit 30 clear
+
+    cout << "\n" << buckets << " buckets, " << lookups << " lookups per run (Mlookups/sec)\n\n";
+    cout << "Chain | Node hits | Node misses | Unrolled hits | Unrolled misses\n";
+    cout << "------|-----------|-------------|---------------|----------------\n";
+
+    for (int len : lengths) {
+        int n = buckets * len;
+        NodeHashTable nt;
+        UnrolledHashTable ut;
+        initNodeTable(&nt, buckets);
+        initTable(&ut, buckets);
+        for (int i = 0; i < n; i++) {
+            nodeInsert(&nt, keys[i]);
+            insert(&ut, keys[i]);
+        }
+
+        double results[4];
+        for (int run = 0; run < 4; run++) {
+            bool unrolled = run >= 2, miss = run % 2 == 1;
+            uint64_t pick = 1234567;
+            int found = 0;
+            auto start = chrono::steady_clock::now();
+            for (int i = 0; i < lookups; i++) {
+                // Setting bit 30 keeps the bucket (2^30 % buckets == 0) but the key is absent
+                int key = keys[nextRandom(&pick) % n] | (miss ? 0x40000000 : 0);
+                found += unrolled ? search(&ut, key) : nodeSearch(&nt, key);
+            }
+            results[run] = lookups / secondsSince(start) / 1e6;
+            if (found != (miss ? 0 : lookups))
+                cout << "Error: wrong lookup result" << endl;
+        }
+        printf("%5d | %9.2f | %11.2f | %13.2f | %15.2f\n",
+               len, results[0], results[1], results[2], results[3]);
+
+        destroyNodeTable(&nt);
+        destroyTable(&ut);
+    }
+    delete[] keys;
+}
+
+int main(int argc, char* argv[]) {
+    UnrolledHashTable ht;
+    initTable(&ht, 10);
+
+    insert(&ht, 15);
+    insert(&ht, 25);
+    insert(&ht, 35);
+    insert(&ht, 7);
+    insert(&ht, -13);               // Negative keys land in a valid bucket too
+    for (int i = 0; i < 15; i++)
+        insert(&ht, 100 + i * 10);  // Overflows bucket 0's inline block
+
+    display(&ht);
+    cout << "search(35): " << search(&ht, 35) << endl;
+    cout << "search(45): " << search(&ht, 45) << endl;
+    cout << "search(-13): " << search(&ht, -13) << endl;
+    destroyTable(&ht);
+
+    // ./openHashing_unrolled bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
+    return 0;
+}
@@ -1,6 +1,10 @@
 #include <iostream>
+#include "../log_policy.h"
 using namespace std;
 
+// insert() and search() print only under VerboseLog (insert<VerboseLog>(key));
+// -DTEACHING_MODE makes that the default (see log_policy.h).
+
 const int SIZE = 10;
 int hashTable[SIZE];
 
@@ -13,6 +17,7 @@ int hashFunc(int key) {
     return key % SIZE;
 }
 
+template <typename Log = DefaultLog>
 bool insert(int key) {
     int index = hashFunc(key);
     int i = 0;  // step counter
@@ -21,16 +26,19 @@ bool insert(int key) {
         int newIndex = (index + i * i) % SIZE;  // quadratic probing
         if (hashTable[newIndex] == -1) {
             hashTable[newIndex] = key;
-            cout << "Inserted " << key << " at index " << newIndex << endl;
+            if (Log::enabled)
+                cout << "Inserted " << key << " at index " << newIndex << endl;
             return true;
         }
         i++;
     }
 
-    cout << "Hash Table is full! Cannot insert " << key << endl;
+    if (Log::enabled)
+        cout << "Hash Table is full! Cannot insert " << key << endl;
     return false;
 }
 
+template <typename Log = DefaultLog>
 bool search(int key) {
     int index = hashFunc(key);
     int i = 0;
@@ -38,14 +46,16 @@ bool search(int key) {
     while (i < SIZE) {
         int newIndex = (index + i * i) % SIZE;
         if (hashTable[newIndex] == key) {
-            cout << "Key " << key << " found at index " << newIndex << endl;
+            if (Log::enabled)
+                cout << "Key " << key << " found at index " << newIndex << endl;
             return true;
         }
         if (hashTable[newIndex] == -1) break; // empty spot, key not present
         i++;
     }
 
-    cout << "Key " << key << " not found in hash table" << endl;
+    if (Log::enabled)
+        cout << "Key " << key << " not found in hash table" << endl;
     return false;
 }
 
@@ -62,13 +72,13 @@ void display() {
 
 int main() {
     initHashTable();
-    insert(10);
-    insert(20);
-    insert(30);
-    insert(25);
-    insert(35);
+    insert<VerboseLog>(10);
+    insert<VerboseLog>(20);
+    insert<VerboseLog>(30);
+    insert<VerboseLog>(25);
+    insert<VerboseLog>(35);
     display();
-    search(20);
-    search(50);
+    search<VerboseLog>(20);
+    search<VerboseLog>(50);
     return 0;
 }
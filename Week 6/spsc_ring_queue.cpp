@@ -0,0 +1,362 @@
+/*
+================================================================================
+LOCK-FREE SPSC RING QUEUE
+================================================================================
+
+WHY NOT JUST SHARE A CircularQueue?
+-----------------------------------
+CircularQueue<T> (circular_queue.cpp) keeps front, rear and count as plain
+ints. If a producer thread calls enqueue() while a consumer thread calls
+dequeue():
+  - both threads do count++ / count-- on the same int -> updates get lost
+  - the compiler and CPU may reorder "write arr[rear]" and "count++", so the
+    consumer can see the new count before the value is in the array
+
+SINGLE PRODUCER / SINGLE CONSUMER (SPSC)
+----------------------------------------
+If exactly ONE thread enqueues and exactly ONE thread dequeues, no lock is
+needed. The trick is to give each index a single writer:
+
+    tail: written only by the producer (next slot to fill)
+    head: written only by the consumer (next slot to read)
+
+There is no shared count; size is tail - head. Both indices only ever grow
+(they are never wrapped), and the slot is index & mask:
+
+    capacity = 8, mask = 7
+    head = 13, tail = 17  -> 4 elements, in slots 5 6 7 0
+
+         0   1   2   3   4   5   6   7
+       [ d ][   ][   ][   ][   ][ a ][ b ][ c ]
+         ^tail%8=1 is next          ^head%8=5
+
+    empty: tail == head
+    full:  tail - head == capacity   (no wasted slot, no count needed)
+
+MEMORY ORDERING
+---------------
+Producer:  arr[tail & mask] = value;           // 1. write the element
+           tail.store(tail + 1, release);      // 2. publish it
+Consumer:  if (tail.load(acquire) != head)     // 3. sees the publish...
+               value = arr[head & mask];       // 4. ...so sees the element
+
+"release" means: nothing before the store may move after it.
+"acquire" means: nothing after the load may move before it.
+Together they guarantee step 4 reads what step 1 wrote. The same pair in
+the other direction (head.store release / head.load acquire) tells the
+producer a slot is free to overwrite.
+
+CACHE LINES
+-----------
+head and tail sit on separate 64-byte cache lines. If they shared one,
+every enqueue would steal the line from the consumer's core and every
+dequeue would steal it back ("false sharing"). Each side also keeps a
+cached copy of the OTHER side's index and only reloads the real atomic
+when the cached value says full/empty, so most operations touch no
+shared line except the slot itself.
+
+Compile: g++ -std=c++17 -O2 -pthread spsc_ring_queue.cpp
+Benchmark: ./a.out bench
+*/
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+//==============================================================================
+// SPSC QUEUE STRUCTURE
+//==============================================================================
+
+const size_t CACHE_LINE = 64;
+
+template <typename T>
+struct SpscQueue {
+    // Consumer's line
+    alignas(CACHE_LINE) atomic<size_t> head;  // Next index to dequeue
+    size_t cachedTail;                        // Consumer's last view of tail
+
+    // Producer's line
+    alignas(CACHE_LINE) atomic<size_t> tail;  // Next index to enqueue
+    size_t cachedHead;                        // Producer's last view of head
+
+    // Read-only after init: shared by both sides without any traffic
+    alignas(CACHE_LINE) T* arr;
+    size_t capacity;                          // Power of two
+    size_t mask;                              // capacity - 1
+};
+
+//==============================================================================
+// INITIALIZATION / CLEANUP
+//==============================================================================
+
+/*
+Capacity is rounded up to a power of two so `index % capacity` becomes
+`index & mask`. Call before starting the producer and consumer threads.
+*/
+template <typename T>
+void initSpscQueue(SpscQueue<T>* queue, size_t capacity) {
+    size_t cap = 1;
+    while (cap < capacity)
+        cap <<= 1;
+
+    queue->arr = new T[cap];
+    queue->capacity = cap;
+    queue->mask = cap - 1;
+    queue->head.store(0, memory_order_relaxed);
+    queue->tail.store(0, memory_order_relaxed);
+    queue->cachedHead = 0;
+    queue->cachedTail = 0;
+}
+
+// Call after both threads have been joined
+template <typename T>
+void destroySpscQueue(SpscQueue<T>* queue) {
+    delete[] queue->arr;
+    queue->arr = nullptr;
+}
+
+//==============================================================================
+// ENQUEUE / DEQUEUE
+//==============================================================================
+
+/*
+ENQUEUE - producer thread only
+Same semantics as CircularQueue's enqueue(): a full queue refuses the
+element and returns false. Time Complexity: O(1), no locks, no allocation.
+*/
+template <typename T>
+bool enqueue(SpscQueue<T>* queue, const T& value) {
+    size_t tail = queue->tail.load(memory_order_relaxed);  // Only we write it
+
+    if (tail - queue->cachedHead == queue->capacity) {
+        // Looks full - refresh our copy of head and check again
+        queue->cachedHead = queue->head.load(memory_order_acquire);
+        if (tail - queue->cachedHead == queue->capacity)
+            return false;
+    }
+
+    queue->arr[tail & queue->mask] = value;
+    queue->tail.store(tail + 1, memory_order_release);  // Publish the element
+    return true;
+}
+
+/*
+DEQUEUE - consumer thread only
+CircularQueue's dequeue() calls exit(1) on an empty queue. An empty queue
+is normal here (the consumer is just ahead of the producer), so this one
+returns false instead and stores the element in *value on success.
+*/
+template <typename T>
+bool dequeue(SpscQueue<T>* queue, T* value) {
+    size_t head = queue->head.load(memory_order_relaxed);  // Only we write it
+
+    if (head == queue->cachedTail) {
+        // Looks empty - refresh our copy of tail and check again
+        queue->cachedTail = queue->tail.load(memory_order_acquire);
+        if (head == queue->cachedTail)
+            return false;
+    }
+
+    *value = queue->arr[head & queue->mask];
+    queue->head.store(head + 1, memory_order_release);  // Free the slot
+    return true;
+}
+
+//==============================================================================
+// HELPER FUNCTIONS
+//==============================================================================
+
+/*
+From a third thread the answer may already be stale when it is returned;
+from the producer (or consumer) it is exact for its own side: the producer
+can trust "not full" and the consumer can trust "not empty".
+*/
+template <typename T>
+size_t size(SpscQueue<T>* queue) {
+    size_t head = queue->head.load(memory_order_acquire);
+    size_t tail = queue->tail.load(memory_order_acquire);
+    return tail - head;
+}
+
+template <typename T>
+bool isEmpty(SpscQueue<T>* queue) {
+    return size(queue) == 0;
+}
+
+template <typename T>
+bool isFull(SpscQueue<T>* queue) {
+    return size(queue) == queue->capacity;
+}
+
+//==============================================================================
+// DEMONSTRATION
+//==============================================================================
+
+void demonstrateSpscQueue() {
+    cout << "\n====================================================\n";
+    cout << "  SPSC RING QUEUE DEMONSTRATION\n";
+    cout << "====================================================\n\n";
+
+    SpscQueue<int> queue;
+    initSpscQueue(&queue, 5);
+    cout << "1. Asked for capacity 5, got " << queue.capacity << " (power of two)\n";
+
+    cout << "\n2. Enqueuing 10, 20, ..., 90:\n   ";
+    for (int v = 10; v <= 90; v += 10)
+        cout << v << (enqueue(&queue, v) ? " ok  " : " FULL  ");
+    cout << "\n   Size: " << size(&queue) << endl;
+
+    int value;
+    cout << "\n3. Dequeuing 3 elements: ";
+    for (int i = 0; i < 3; i++) {
+        dequeue(&queue, &value);
+        cout << value << " ";
+    }
+    cout << "\n   head=" << queue.head.load() << ", tail=" << queue.tail.load()
+         << ", size=" << size(&queue) << endl;
+
+    // One producer thread, one consumer thread (this one)
+    cout << "\n4. Producer thread sends 1..100000 while main thread consumes:\n";
+    while (dequeue(&queue, &value)) {}  // Start empty
+
+    const int n = 100000;
+    thread producer([&queue]() {
+        for (int i = 1; i <= n; i++) {
+            while (!enqueue(&queue, i))
+                this_thread::yield();    // Full: let the consumer run
+        }
+    });
+
+    long long sum = 0;
+    int expected = 1;
+    bool inOrder = true;
+    for (int received = 0; received < n; received++) {
+        while (!dequeue(&queue, &value))
+            this_thread::yield();        // Empty: let the producer run
+        inOrder = inOrder && value == expected++;
+        sum += value;
+    }
+    producer.join();
+
+    cout << "   Sum = " << sum << " (expected " << (long long)n * (n + 1) / 2 << ")"
+         << ", FIFO order " << (inOrder ? "kept" : "BROKEN") << endl;
+
+    destroySpscQueue(&queue);
+}
+
+//==============================================================================
+// BENCHMARK
+//==============================================================================
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+THROUGHPUT: one producer pushes n ints as fast as it can, one consumer
+pops them. When a side finds the queue full/empty it yields, which matters
+on machines with fewer cores than threads: spinning would burn the rest of
+the time slice while the other side cannot run.
+*/
+double benchmarkThroughput(size_t capacity, int n) {
+    SpscQueue<int> queue;
+    initSpscQueue(&queue, capacity);
+
+    auto start = chrono::steady_clock::now();
+    thread producer([&queue, n]() {
+        for (int i = 0; i < n; i++) {
+            while (!enqueue(&queue, i))
+                this_thread::yield();
+        }
+    });
+
+    long long sum = 0;
+    int value;
+    for (int received = 0; received < n; received++) {
+        while (!dequeue(&queue, &value))
+            this_thread::yield();
+        sum += value;
+    }
+    producer.join();
+    double elapsed = secondsSince(start);
+
+    if (sum != (long long)n * (n - 1) / 2)
+        cout << "Error: lost or duplicated messages" << endl;
+    destroySpscQueue(&queue);
+    return n / elapsed;
+}
+
+/*
+LATENCY: ping-pong between two threads over two queues. Each round trip
+is one message each way, so one-way latency ~= round trip / 2. This is
+the hand-off cost when the consumer is waiting, the opposite of the
+throughput test where the queue is kept busy.
+*/
+void benchmarkLatency(int rounds) {
+    SpscQueue<int> ping, pong;
+    initSpscQueue(&ping, 64);
+    initSpscQueue(&pong, 64);
+
+    thread echo([&ping, &pong, rounds]() {
+        int value;
+        for (int i = 0; i < rounds; i++) {
+            while (!dequeue(&ping, &value))
+                this_thread::yield();
+            while (!enqueue(&pong, value))
+                this_thread::yield();
+        }
+    });
+
+    vector<double> trips(rounds);
+    int value;
+    for (int i = 0; i < rounds; i++) {
+        auto start = chrono::steady_clock::now();
+        enqueue(&ping, i);
+        while (!dequeue(&pong, &value))
+            this_thread::yield();
+        trips[i] = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    }
+    echo.join();
+
+    sort(trips.begin(), trips.end());
+    printf("\nLatency (%d ping-pong round trips, one-way = round trip / 2):\n", rounds);
+    printf("  p50 %8.0f ns   p99 %8.0f ns   max %10.0f ns\n",
+           trips[rounds / 2] / 2, trips[rounds * 99 / 100] / 2, trips[rounds - 1] / 2);
+
+    destroySpscQueue(&ping);
+    destroySpscQueue(&pong);
+}
+
+void benchmark() {
+    const int n = 20000000;
+    const size_t capacities[] = {64, 1024, 16384, 262144};
+
+    cout << "\nHardware threads: " << thread::hardware_concurrency() << "\n";
+    cout << "\nThroughput (" << n << " ints, 1 producer -> 1 consumer)\n";
+    cout << "Capacity | Messages/sec\n";
+    cout << "---------|-------------\n";
+    for (size_t capacity : capacities)
+        printf("%8zu | %12.0f\n", capacity, benchmarkThroughput(capacity, n));
+
+    benchmarkLatency(100000);
+}
+
+//==============================================================================
+// MAIN FUNCTION
+//==============================================================================
+
+int main(int argc, char* argv[]) {
+    demonstrateSpscQueue();
+
+    // ./spsc_ring_queue bench
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+        benchmark();
+    return 0;
+}
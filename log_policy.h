@@ -0,0 +1,22 @@
+#ifndef LOG_POLICY_H
+#define LOG_POLICY_H
+
+/*
+LOGGING POLICY
+--------------
+Functions that print on every call take the policy as a template
+parameter: `insert<VerboseLog>(...)` prints, `insert<SilentLog>(...)` (the
+default) compiles the printing away, because `if (Log::enabled)` is a
+constant. Building with -DTEACHING_MODE makes VerboseLog the default, so
+the demos print every step.
+*/
+struct VerboseLog { static const bool enabled = true; };
+struct SilentLog  { static const bool enabled = false; };
+
+#ifdef TEACHING_MODE
+typedef VerboseLog DefaultLog;
+#else
+typedef SilentLog DefaultLog;
+#endif
+
+#endif